@@ -543,7 +543,9 @@ void MELAchievementLoadStatus(const MELAchievementData data) {
     achievementStatus.count = achievementCount;
     memset(achievementStatus.memory, 0, sizeof(MELAchievementStatus) * achievementCount);
 
-    MELAchievementStatusRefDictionary statusDictionary = (MELAchievementStatusRefDictionary) {};
+    // Les identifiants appartiennent à `data` qui survit au dictionnaire : inutile de les copier.
+    MELAchievementStatusRefDictionary statusDictionary = MELAchievementStatusRefDictionaryMakeWithBorrowedKeys();
+    MELAchievementStatusRefDictionaryReserve(&statusDictionary, achievementCount);
     for (unsigned int index = 0; index < achievementCount; index++) {
         const char *id = data.achievements.memory[index].id;
         MELAchievementStatusRefDictionaryPut(&statusDictionary, id, achievementStatus.memory + index);
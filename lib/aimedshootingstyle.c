@@ -7,14 +7,16 @@
 
 #include "aimedshootingstyle.h"
 
-#include "bullet.h"
+#include "sprite.h"
 #include "random.h"
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle);
 
 static const MELShootingStyleClass AimedShootingStyleClass = (MELShootingStyleClass) {
     .name = MELShootingStyleClassNameAimed,
-    .createBullets = createBullets,
+    .compile = compile,
+    .volleyAngle = volleyAngle,
 };
 
 const MELShootingStyleClass * _Nonnull AimedShootingStyleGetClass(void) {
@@ -26,27 +28,26 @@ void AimedShootingStyleInit(MELShootingStyle * _Nonnull self, const AimedShootin
         .class = &AimedShootingStyleClass,
         .definition = &definition->super,
         .shootInterval = MELRandomFloat(definition->super.shootInterval),
-        .bulletAmount = definition->super.bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->super.bulletAmount),
         .bulletAmountVariation = definition->super.bulletAmountVariation,
         .inversionInterval = definition->super.inversionInterval,
     };
 }
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
-    const AimedShootingStyleDefinition *definition = (AimedShootingStyleDefinition *)self->definition;
-
-    LCDSprite *target = definition->getTarget(self->userdata);
-    MELSprite *melTarget = playdate->sprite->getUserdata(target);
-
-    const float bulletSpeed = definition->super.bulletSpeed;
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern) {
+    const float bulletSpeed = self->definition->bulletSpeed;
     const unsigned int bulletAmount = self->bulletAmount;
     for (unsigned int index = 0; index < bulletAmount; index++) {
-        const float angleToTarget = MELPointAngleToPoint(melTarget->frame.origin, origin);
+        MELBulletPatternPush(pattern, MELBulletEmissionMake(0.0f, 0.0f, bulletSpeed, MELPointZero));
+    }
+}
 
-        const MELPoint speed = (MELPoint) {
-            .x = cosf(angleToTarget) * bulletSpeed,
-            .y = sinf(angleToTarget) * bulletSpeed
-        };
-        BulletConstructor(&definition->super, origin, speed, initialDelta);
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle) {
+    const AimedShootingStyleDefinition *definition = (AimedShootingStyleDefinition *)self->definition;
+    if (!definition->getTarget) {
+        return angle;
     }
+    LCDSprite *target = definition->getTarget(self->userdata);
+    MELSprite *melTarget = playdate->sprite->getUserdata(target);
+    return MELPointAngleToPoint(melTarget->frame.origin, origin);
 }
@@ -16,6 +16,8 @@ typedef struct {
     LCDSprite * _Nonnull (* _Nullable getTarget)(void * _Nullable userdata);
 } AimedShootingStyleDefinition;
 
+const MELShootingStyleClass * _Nonnull AimedShootingStyleGetClass(void);
+
 void AimedShootingStyleInit(MELShootingStyle * _Nonnull self, const AimedShootingStyleDefinition * _Nonnull definition);
 
 #endif /* aimedshootingstyle_h */
@@ -38,7 +38,8 @@ void MELAlignmentSet(LCDSprite * _Nonnull sprite, MELHorizontalAlignment horizon
     MELRectangle frame = self->frame;
     frame.origin = MELOriginForSizeAndAlignment(origin, frame.size, horizontalAlignment, verticalAlignment);
     self->frame = frame;
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(frame.origin));
+    MELHitboxInvalidate(self->hitbox);
+    MELSpritePushPosition(self, sprite, frame.origin.x, frame.origin.y);
 }
 
 LCDSprite * _Nonnull MELAlignmentWith(LCDSprite * _Nonnull sprite, MELHorizontalAlignment horizontalAlignment, MELVerticalAlignment verticalAlignment, MELPoint origin) {
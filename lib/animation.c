@@ -40,7 +40,7 @@ void MELAnimationNoopStart(MELAnimation * _Nonnull self) {
 
 void MELAnimationDraw(MELAnimation * _Nonnull self, LCDSprite * _Nonnull sprite) {
     MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(melSprite->definition.palette, self->frame.atlasIndex), MELDirectionFlip[melSprite->direction]);
+    MELSpritePushImage(melSprite, sprite, MELDirectionFlip[melSprite->direction]);
 }
 
 MELAnimation MELAnimationTransitionToAnimation(MELAnimation * _Nonnull self, MELAnimation nextAnimation) {
@@ -55,9 +55,17 @@ MELAnimationDefinition MELAnimationDefinitionMakeWithInputStream(MELInputStream
     self.frameCount = mainFrameCount;
     self.frames = mainFrames;
     self.type = MELAnimationTypeForFrameCountAndLooping(mainFrameCount, looping);
+    self.frameCountDivider = (MELIntDivider) {};
+    MELAnimationDefinitionPrepareDivider(&self);
     return self;
 }
 
+void MELAnimationDefinitionPrepareDivider(MELAnimationDefinition * _Nonnull self) {
+    if (self->frameCount > 0 && self->frameCountDivider.divisor != (int32_t) self->frameCount) {
+        self->frameCountDivider = MELIntDividerMake(self->frameCount);
+    }
+}
+
 MELTimeInterval MELAnimationDefinitionDuration(MELAnimationDefinition self) {
     return (MELTimeInterval)self.frameCount / self.frequency;
 }
@@ -66,6 +74,7 @@ void MELAnimationDefinitionDeinit(MELAnimationDefinition *_Nonnull self) {
 	free(self->frames);
 	self->frames = NULL;
 	self->frameCount = 0;
+	self->frameCountDivider = (MELIntDivider) {};
 	self->frequency = 0;
 	self->type = MELAnimationTypeNone;
 }
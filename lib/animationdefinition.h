@@ -15,6 +15,7 @@
 #include "animationtype.h"
 #include "inputstream.h"
 #include "list.h"
+#include "divider.h"
 
 /**
  * Definition of an animation.
@@ -40,6 +41,11 @@ typedef struct {
      * Frame index to loop from.
      */
     unsigned int loopStart;
+    /**
+     * Division by frameCount. Prepared when the definition is loaded or,
+     * for generated definitions, by MELSpriteDefinitionGetAnimation.
+     */
+    MELIntDivider frameCountDivider;
 } MELAnimationDefinition;
 
 MELListDefine(MELAnimationDefinition);
@@ -51,6 +57,14 @@ MELAnimationDefinition MELAnimationDefinitionMakeWithAnimationDefinition(MELAnim
  */
 MELAnimationDefinition MELAnimationDefinitionMakeWithInputStream(MELInputStream * _Nonnull inputStream);
 
+/**
+ * Prepares the frameCount divider of the given animation definition.
+ * Does nothing if the divider is already up to date.
+ *
+ * @param self Animation definition instance.
+ */
+void MELAnimationDefinitionPrepareDivider(MELAnimationDefinition * _Nonnull self);
+
 /**
  * Returns the duration of the given animation definition.
  *
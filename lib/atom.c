@@ -0,0 +1,176 @@
+//
+//  atom.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "atom.h"
+
+#include <string.h>
+#include "melstring.h"
+
+MELListImplement(MELAtom);
+
+/// Taille d'un bloc de texte. Les chaînes plus longues ont leur propre bloc.
+#define kChunkSize 1024
+
+/// Capacité minimale de la table. Toujours une puissance de 2.
+#define kMinimumCapacity 64
+
+/**
+ * En-tête placé juste avant le texte de chaque atome.
+ */
+typedef struct {
+    uint32_t hash;
+    uint32_t index;
+    uint32_t length;
+} MELAtomHeader;
+
+typedef struct melatomchunk {
+    struct melatomchunk * _Nullable next;
+    unsigned int size;
+    unsigned int capacity;
+} MELAtomChunk;
+
+/// Atomes dans l'ordre de création.
+static MELAtomList atoms;
+/// Index + 1 des atomes, rangés par hash. 0 pour une case vide.
+static uint32_t * _Nullable slots;
+static unsigned int capacity;
+static MELAtomChunk * _Nullable chunks;
+
+static MELAtomHeader * _Nonnull headerOfAtom(MELAtom _Nonnull atom) {
+    return ((MELAtomHeader *) atom) - 1;
+}
+
+static int indexOfSlot(const char * _Nonnull string, unsigned int length, uint32_t hash) {
+    if (slots == NULL) {
+        return -1;
+    }
+    const unsigned int mask = capacity - 1;
+    unsigned int slot = hash & mask;
+    while (slots[slot]) {
+        MELAtom atom = atoms.memory[slots[slot] - 1];
+        const MELAtomHeader *header = headerOfAtom(atom);
+        if (header->hash == hash && header->length == length && !memcmp(atom, string, length)) {
+            return (int) slot;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+static void rehash(unsigned int newCapacity) {
+    uint32_t *newSlots = playdate->system->realloc(NULL, sizeof(uint32_t) * newCapacity);
+    memset(newSlots, 0, sizeof(uint32_t) * newCapacity);
+    const unsigned int mask = newCapacity - 1;
+    for (unsigned int index = 0; index < atoms.count; index++) {
+        unsigned int slot = headerOfAtom(atoms.memory[index])->hash & mask;
+        while (newSlots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        newSlots[slot] = index + 1;
+    }
+    playdate->system->realloc(slots, 0);
+    slots = newSlots;
+    capacity = newCapacity;
+}
+
+static MELAtomHeader * _Nonnull allocateHeader(unsigned int length) {
+    // Taille arrondie au multiple de 4 supérieur pour garder les en-têtes alignés.
+    const unsigned int size = (sizeof(MELAtomHeader) + length + 1 + 3) & ~3u;
+    MELAtomChunk *chunk = chunks;
+    if (chunk == NULL || chunk->capacity - chunk->size < size) {
+        const unsigned int chunkCapacity = size > kChunkSize ? size : kChunkSize;
+        chunk = playdate->system->realloc(NULL, sizeof(MELAtomChunk) + chunkCapacity);
+        *chunk = (MELAtomChunk) {
+            .next = chunks,
+            .size = 0,
+            .capacity = chunkCapacity,
+        };
+        chunks = chunk;
+    }
+    MELAtomHeader *header = (MELAtomHeader *) ((uint8_t *) (chunk + 1) + chunk->size);
+    chunk->size += size;
+    return header;
+}
+
+MELAtom _Nullable MELAtomMake(const char * _Nullable string) {
+    if (string == NULL) {
+        return NULL;
+    }
+    return MELAtomMakeWithLength(string, (unsigned int) strlen(string));
+}
+
+MELAtom _Nonnull MELAtomMakeWithLength(const char * _Nonnull string, unsigned int length) {
+    const uint32_t hash = MELStringHashWithLength(string, length);
+    const int existingSlot = indexOfSlot(string, length, hash);
+    if (existingSlot >= 0) {
+        return atoms.memory[slots[existingSlot] - 1];
+    }
+    if (capacity == 0 || (atoms.count + 1) * 4 > capacity * 3) {
+        rehash(capacity == 0 ? kMinimumCapacity : capacity * 2);
+    }
+    MELAtomHeader *header = allocateHeader(length);
+    *header = (MELAtomHeader) {
+        .hash = hash,
+        .index = atoms.count,
+        .length = length,
+    };
+    char *text = (char *) (header + 1);
+    memcpy(text, string, length);
+    text[length] = '\0';
+    MELAtomListPush(&atoms, text);
+
+    const unsigned int mask = capacity - 1;
+    unsigned int slot = hash & mask;
+    while (slots[slot]) {
+        slot = (slot + 1) & mask;
+    }
+    slots[slot] = atoms.count;
+    return text;
+}
+
+MELAtom _Nullable MELAtomGet(const char * _Nullable string) {
+    if (string == NULL) {
+        return NULL;
+    }
+    const unsigned int length = (unsigned int) strlen(string);
+    const int slot = indexOfSlot(string, length, MELStringHashWithLength(string, length));
+    return slot >= 0 ? atoms.memory[slots[slot] - 1] : NULL;
+}
+
+unsigned int MELAtomGetIndex(MELAtom _Nonnull atom) {
+    return headerOfAtom(atom)->index;
+}
+
+MELAtom _Nullable MELAtomGetWithIndex(unsigned int index) {
+    return index < atoms.count ? atoms.memory[index] : NULL;
+}
+
+unsigned int MELAtomGetLength(MELAtom _Nonnull atom) {
+    return headerOfAtom(atom)->length;
+}
+
+uint32_t MELAtomGetHash(MELAtom _Nonnull atom) {
+    return headerOfAtom(atom)->hash;
+}
+
+unsigned int MELAtomCount(void) {
+    return atoms.count;
+}
+
+void MELAtomTableDeinit(void) {
+    MELAtomChunk *chunk = chunks;
+    while (chunk != NULL) {
+        MELAtomChunk *next = chunk->next;
+        playdate->system->realloc(chunk, 0);
+        chunk = next;
+    }
+    chunks = NULL;
+    MELAtomListDeinit(&atoms);
+    playdate->system->realloc(slots, 0);
+    slots = NULL;
+    capacity = 0;
+}
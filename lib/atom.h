@@ -0,0 +1,68 @@
+//
+//  atom.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef atom_h
+#define atom_h
+
+#include "melstd.h"
+
+#include "list.h"
+
+/**
+ * Chaîne internée : il n'existe qu'un seul atome pour un texte donné.
+ *
+ * Deux atomes sont égaux si et seulement si leurs pointeurs sont égaux. Un atome est une chaîne
+ * terminée par un zéro et peut être utilisé directement comme clé d'un dictionnaire créé avec
+ * `MakeWithBorrowedKeys` : la clé n'est pas copiée et la comparaison se fait sur le pointeur.
+ * Les fonctions `PutWithAtom` et `GetWithAtom` du dictionnaire réutilisent le hash de l'atome
+ * au lieu de parcourir la chaîne.
+ *
+ * Les atomes restent valides jusqu'à l'appel de `MELAtomTableDeinit`.
+ */
+typedef const char * MELAtom;
+MELListDefine(MELAtom);
+
+#define MELAtomEquals(lhs, rhs) ((lhs) == (rhs))
+
+/**
+ * Renvoie l'atome correspondant à la chaîne donnée, en le créant si besoin.
+ *
+ * @param string Chaîne à interner. Elle est copiée lors de la création de l'atome.
+ * @return L'atome ou NULL si `string` est NULL.
+ */
+MELAtom _Nullable MELAtomMake(const char * _Nullable string);
+
+/**
+ * Renvoie l'atome correspondant aux `length` premiers caractères de la chaîne donnée, en le créant si besoin.
+ * La chaîne n'a pas besoin d'être terminée par un zéro.
+ */
+MELAtom _Nonnull MELAtomMakeWithLength(const char * _Nonnull string, unsigned int length);
+
+/**
+ * Renvoie l'atome correspondant à la chaîne donnée s'il existe déjà. N'alloue jamais de mémoire.
+ *
+ * @return L'atome ou NULL si la chaîne n'a jamais été internée.
+ */
+MELAtom _Nullable MELAtomGet(const char * _Nullable string);
+
+/// Numéro de l'atome, attribué dans l'ordre de création à partir de 0.
+unsigned int MELAtomGetIndex(MELAtom _Nonnull atom);
+MELAtom _Nullable MELAtomGetWithIndex(unsigned int index);
+
+unsigned int MELAtomGetLength(MELAtom _Nonnull atom);
+
+/// Hash de l'atome, égal à `MELStringHash(atom)`. Calculé une seule fois à la création.
+uint32_t MELAtomGetHash(MELAtom _Nonnull atom);
+
+unsigned int MELAtomCount(void);
+
+/**
+ * Libère tous les atomes. Les atomes renvoyés auparavant ne doivent plus être utilisés.
+ */
+void MELAtomTableDeinit(void);
+
+#endif /* atom_h */
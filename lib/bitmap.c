@@ -74,18 +74,17 @@ void MELOutputStreamWriteBitmap(MELOutputStream * _Nonnull outputStream, LCDBitm
     MELOutputStreamWriteInt16(outputStream, coreHeader.planes);
     MELOutputStreamWriteInt16(outputStream, coreHeader.bitsPerPixel);
 
-    const int32_t count = width * height;
-    for (int32_t index = 0; index < count; index++) {
-        const int32_t x = index % width;
-        const int32_t y = height - (index / width) - 1;
-
-        const int32_t byteIndex = x / bitsInAByte + y * rowBytes;
-        const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
-
-        const uint8_t color = data[byteIndex] & bitIndex ? 0xFF : 0x00;
-        MELOutputStreamWriteUInt8(outputStream, color); // Red
-        MELOutputStreamWriteUInt8(outputStream, color); // Green
-        MELOutputStreamWriteUInt8(outputStream, color); // Blue
+    for (int32_t y = height - 1; y >= 0; y--) {
+        const uint8_t *row = data + y * rowBytes;
+        for (int32_t x = 0; x < width; x++) {
+            const int32_t byteIndex = x / bitsInAByte;
+            const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
+
+            const uint8_t color = row[byteIndex] & bitIndex ? 0xFF : 0x00;
+            MELOutputStreamWriteUInt8(outputStream, color); // Red
+            MELOutputStreamWriteUInt8(outputStream, color); // Green
+            MELOutputStreamWriteUInt8(outputStream, color); // Blue
+        }
     }
 }
 
@@ -101,22 +100,21 @@ void MELOutputStreamWritePNG(MELOutputStream * _Nonnull outputStream, LCDBitmap
 
     uint8_t *rgba = playdate->system->realloc(NULL, width * height * channelCount);
 
-    const int32_t count = width * height;
-    for (int32_t index = 0; index < count; index++) {
-        const int32_t x = index % width;
-        const int32_t y = index / width;
-
-        const int32_t byteIndex = x / bitsInAByte + y * rowBytes;
-        const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
+    unsigned int rgbaIndex = 0;
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            const int32_t byteIndex = x / bitsInAByte + y * rowBytes;
+            const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
 
-        const uint8_t color = (data[byteIndex] & bitIndex) ? 0xFF : 0x00;
-        const uint8_t alpha = mask != NULL
-            ? ((mask[byteIndex] & bitIndex) ? 0xFF : 0x00)
-            : 0xFF;
+            const uint8_t color = (data[byteIndex] & bitIndex) ? 0xFF : 0x00;
+            const uint8_t alpha = mask != NULL
+                ? ((mask[byteIndex] & bitIndex) ? 0xFF : 0x00)
+                : 0xFF;
 
-        const unsigned int rgbaIndex = index * channelCount;
-        rgba[rgbaIndex] = color;
-        rgba[rgbaIndex + 1] = alpha;
+            rgba[rgbaIndex] = color;
+            rgba[rgbaIndex + 1] = alpha;
+            rgbaIndex += channelCount;
+        }
     }
 
     size_t pngSize;
@@ -183,22 +181,22 @@ void LCDBitmapFadeImage(LCDBitmap * _Nonnull bitmap, uint8_t value) {
     memset(data, 0, rowBytes * height);
 
     const uint8_t threshold = (value * 64) / 100;
-    const unsigned int size = width * height;
-    for (unsigned int index = 0; index < size; index++) {
-        const int x = index % width;
-        const int y = index / width;
-
-        // Appliquer la matrice de Bayer à l'emplacement courant
-        const uint8_t bayerValue = bayerMatrix[y % 8][x % 8];
-
-        // Comparer la valeur du pixel avec le seuil pour la conversion
-        if (bayerValue < threshold) {
-            const int32_t bitsInAByte = 8;
-            const int32_t byteIndex = x / bitsInAByte + y * rowBytes;
-            const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
-
-            // NOTE: Avant j'affectais la valeur "data[byteIndex] & ~bitIndex" à data[byteIndex] mais vu que data[byteIndex] vaut toujours zéro, cela n'a pas d'utilité.
-            mask[byteIndex] = mask[byteIndex] | bitIndex;
+    for (int y = 0; y < height; y++) {
+        const uint8_t *bayerRow = bayerMatrix[y % 8];
+        uint8_t *maskRow = mask + y * rowBytes;
+        for (int x = 0; x < width; x++) {
+            // Appliquer la matrice de Bayer à l'emplacement courant
+            const uint8_t bayerValue = bayerRow[x % 8];
+
+            // Comparer la valeur du pixel avec le seuil pour la conversion
+            if (bayerValue < threshold) {
+                const int32_t bitsInAByte = 8;
+                const int32_t byteIndex = x / bitsInAByte;
+                const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
+
+                // NOTE: Avant j'affectais la valeur "data[byteIndex] & ~bitIndex" à data[byteIndex] mais vu que data[byteIndex] vaut toujours zéro, cela n'a pas d'utilité.
+                maskRow[byteIndex] = maskRow[byteIndex] | bitIndex;
+            }
         }
     }
 }
@@ -226,21 +224,21 @@ void LCDBitmapShadeImage(LCDBitmap * _Nonnull bitmap, float brightness) {
     if (threshold == 0) {
         return;
     }
-    const unsigned int size = width * height;
-    for (unsigned int index = 0; index < size; index++) {
-        const int x = index % width;
-        const int y = index / width;
-
-        // Appliquer la matrice de Bayer à l'emplacement courant
-        const uint8_t bayerValue = bayerMatrix[y % 8][x % 8];
-
-        // Comparer la valeur du pixel avec le seuil pour la conversion
-        if (bayerValue < threshold) {
-            const int32_t bitsInAByte = 8;
-            const int32_t byteIndex = x / bitsInAByte + y * rowBytes;
-            const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
-
-            data[byteIndex] = data[byteIndex] & ~bitIndex;
+    for (int y = 0; y < height; y++) {
+        const uint8_t *bayerRow = bayerMatrix[y % 8];
+        uint8_t *dataRow = data + y * rowBytes;
+        for (int x = 0; x < width; x++) {
+            // Appliquer la matrice de Bayer à l'emplacement courant
+            const uint8_t bayerValue = bayerRow[x % 8];
+
+            // Comparer la valeur du pixel avec le seuil pour la conversion
+            if (bayerValue < threshold) {
+                const int32_t bitsInAByte = 8;
+                const int32_t byteIndex = x / bitsInAByte;
+                const int bitIndex = (1 << (bitsInAByte - 1)) >> (x % bitsInAByte);
+
+                dataRow[byteIndex] = dataRow[byteIndex] & ~bitIndex;
+            }
         }
     }
 }
@@ -0,0 +1,154 @@
+//
+//  bitmapmask.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "bitmapmask.h"
+
+#include "melmath.h"
+#include "primitives.h"
+#include "keyvaluetable.h"
+
+MELKeyValueTableDefine(MELPointer, MELBitmapMaskRef);
+MELKeyValueTableImplement(MELPointer, MELBitmapMaskRef);
+
+static MELPointerMELBitmapMaskRefTable cache;
+
+static MELBoolean intersects(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, const MELBitmapMask * _Nullable other, MELIntPoint otherTopLeft, MELIntRectangle area);
+
+MELBitmapMask MELBitmapMaskMake(LCDBitmap * _Nonnull bitmap, LCDBitmapFlip flip) {
+    int bitmapWidth, bitmapHeight, rowBytes;
+    uint8_t *mask = NULL;
+    uint8_t *data = NULL;
+    playdate->graphics->getBitmapData(bitmap, &bitmapWidth, &bitmapHeight, &rowBytes, &mask, &data);
+
+#if MELSCREEN_ORIENTATION_VERTICAL
+    // Le monde est tourné d'un quart de tour par rapport à l'écran (voir MOVETO_XY).
+    const int width = bitmapHeight;
+    const int height = bitmapWidth;
+#else
+    const int width = bitmapWidth;
+    const int height = bitmapHeight;
+#endif
+    const int wordsPerRow = (width + 31) / 32 + 1;
+    uint32_t *words = playdate->system->realloc(NULL, sizeof(uint32_t) * wordsPerRow * height);
+    memset(words, 0, sizeof(uint32_t) * wordsPerRow * height);
+
+    const MELBoolean flipX = flip == kBitmapFlippedX || flip == kBitmapFlippedXY;
+    const MELBoolean flipY = flip == kBitmapFlippedY || flip == kBitmapFlippedXY;
+    for (int y = 0; y < height; y++) {
+        uint32_t *row = words + y * wordsPerRow;
+        for (int x = 0; x < width; x++) {
+#if MELSCREEN_ORIENTATION_VERTICAL
+            int sourceX = y;
+            int sourceY = bitmapHeight - 1 - x;
+#else
+            int sourceX = x;
+            int sourceY = y;
+#endif
+            sourceX = flipX ? bitmapWidth - 1 - sourceX : sourceX;
+            sourceY = flipY ? bitmapHeight - 1 - sourceY : sourceY;
+            const MELBoolean opaque = mask == NULL || (mask[sourceY * rowBytes + (sourceX >> 3)] & (0x80 >> (sourceX & 7)));
+            if (opaque) {
+                row[x >> 5] |= 0x80000000u >> (x & 31);
+            }
+        }
+    }
+    return (MELBitmapMask) {
+        .width = width,
+        .height = height,
+        .wordsPerRow = wordsPerRow,
+        .words = words,
+    };
+}
+
+void MELBitmapMaskDeinit(MELBitmapMask * _Nonnull self) {
+    playdate->system->realloc(self->words, 0);
+    self->words = NULL;
+}
+
+const MELBitmapMask * _Nonnull MELBitmapMaskGet(LCDBitmap * _Nonnull bitmap, LCDBitmapFlip flip) {
+    // Les adresses des images sont alignées, les 2 bits de poids faible sont libres pour le retournement.
+    const MELPointer key = (MELPointer) bitmap | (MELPointer) flip;
+    MELBitmapMask *mask = NULL;
+    if (!MELPointerMELBitmapMaskRefTableGet(cache, key, &mask)) {
+        mask = new(MELBitmapMask);
+        *mask = MELBitmapMaskMake(bitmap, flip);
+        MELPointerMELBitmapMaskRefTablePut(&cache, key, mask);
+    }
+    return mask;
+}
+
+void MELBitmapMaskClearCache(void) {
+    unsigned int cursor = 0;
+    MELPointerMELBitmapMaskRefTableEntry entry;
+    while (MELPointerMELBitmapMaskRefTableNextEntry(&cache, &cursor, &entry)) {
+        MELBitmapMask *mask = entry.value;
+        MELBitmapMaskDeinit(mask);
+        playdate->system->realloc(mask, 0);
+    }
+    MELPointerMELBitmapMaskRefTableDeinit(&cache);
+}
+
+MELBoolean MELBitmapMaskIntersectsMask(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, const MELBitmapMask * _Nonnull other, MELIntPoint otherTopLeft) {
+    const int left = MELIntMax(topLeft.x, otherTopLeft.x);
+    const int top = MELIntMax(topLeft.y, otherTopLeft.y);
+    const int right = MELIntMin(topLeft.x + self->width, otherTopLeft.x + other->width);
+    const int bottom = MELIntMin(topLeft.y + self->height, otherTopLeft.y + other->height);
+    return intersects(self, topLeft, other, otherTopLeft, (MELIntRectangle) {
+        .origin = {left, top},
+        .size = {right - left, bottom - top},
+    });
+}
+
+MELBoolean MELBitmapMaskIntersectsRectangle(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, MELIntRectangle rectangle) {
+    const int left = MELIntMax(topLeft.x, rectangle.origin.x);
+    const int top = MELIntMax(topLeft.y, rectangle.origin.y);
+    const int right = MELIntMin(topLeft.x + self->width, rectangle.origin.x + rectangle.size.width);
+    const int bottom = MELIntMin(topLeft.y + self->height, rectangle.origin.y + rectangle.size.height);
+    return intersects(self, topLeft, NULL, (MELIntPoint) {}, (MELIntRectangle) {
+        .origin = {left, top},
+        .size = {right - left, bottom - top},
+    });
+}
+
+MELBoolean MELBitmapMaskGetPixel(const MELBitmapMask * _Nonnull self, int x, int y) {
+    if (x < 0 || y < 0 || x >= self->width || y >= self->height) {
+        return false;
+    }
+    return (self->words[y * self->wordsPerRow + (x >> 5)] >> (31 - (x & 31))) & 1;
+}
+
+/**
+ * Lit 32 pixels de la ligne donnée à partir du pixel `x`.
+ */
+static inline uint32_t readWord(const uint32_t * _Nonnull row, int x) {
+    const int index = x >> 5;
+    const int shift = x & 31;
+    return shift == 0
+        ? row[index]
+        : (row[index] << shift) | (row[index + 1] >> (32 - shift));
+}
+
+static MELBoolean intersects(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, const MELBitmapMask * _Nullable other, MELIntPoint otherTopLeft, MELIntRectangle area) {
+    if (area.size.width <= 0 || area.size.height <= 0) {
+        return false;
+    }
+    const int right = area.origin.x + area.size.width;
+    const int bottom = area.origin.y + area.size.height;
+    for (int y = area.origin.y; y < bottom; y++) {
+        const uint32_t *row = self->words + (y - topLeft.y) * self->wordsPerRow;
+        const uint32_t *otherRow = other != NULL ? other->words + (y - otherTopLeft.y) * other->wordsPerRow : NULL;
+        for (int x = area.origin.x; x < right; x += 32) {
+            const int remaining = right - x;
+            const uint32_t visible = remaining >= 32 ? 0xFFFFFFFFu : ~(0xFFFFFFFFu >> remaining);
+            const uint32_t otherWord = otherRow != NULL ? readWord(otherRow, x - otherTopLeft.x) : 0xFFFFFFFFu;
+            if (readWord(row, x - topLeft.x) & otherWord & visible) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,74 @@
+//
+//  bitmapmask.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef bitmapmask_h
+#define bitmapmask_h
+
+#include "melstd.h"
+
+#include "point.h"
+#include "rectangle.h"
+
+/**
+ * Masque 1 bit d'une image, orienté comme le monde : un bit à 1 par pixel opaque.
+ *
+ * Chaque ligne occupe `wordsPerRow` mots de 32 bits, le pixel le plus à gauche étant dans le bit de poids fort.
+ * Un mot vide termine chaque ligne pour pouvoir lire 32 bits à partir de n'importe quel pixel.
+ */
+typedef struct {
+    int width;
+    int height;
+    int wordsPerRow;
+    uint32_t * _Nullable words;
+} MELBitmapMask;
+
+typedef MELBitmapMask * _Nullable MELBitmapMaskRef;
+
+/**
+ * Crée le masque de l'image donnée telle qu'elle est affichée avec le retournement donné.
+ * Si l'image n'a pas de masque, tous ses pixels sont considérés comme opaques.
+ */
+MELBitmapMask MELBitmapMaskMake(LCDBitmap * _Nonnull bitmap, LCDBitmapFlip flip);
+void MELBitmapMaskDeinit(MELBitmapMask * _Nonnull self);
+
+/**
+ * Retourne le masque de l'image donnée. Le masque n'est créé qu'une fois par image et par retournement.
+ *
+ * @param bitmap Image, généralement une frame d'un `LCDBitmapTable`.
+ * @param flip Retournement appliqué à l'affichage, généralement `MELDirectionFlip[sprite->direction]`.
+ * @return Le masque de l'image. Il reste valide jusqu'au prochain appel à `MELBitmapMaskClearCache`.
+ */
+const MELBitmapMask * _Nonnull MELBitmapMaskGet(LCDBitmap * _Nonnull bitmap, LCDBitmapFlip flip);
+
+/**
+ * Libère tous les masques créés par `MELBitmapMaskGet`.
+ * Appelé par `MELSpriteDefinitionFreePalette` puisque les images des masques peuvent alors être libérées.
+ */
+void MELBitmapMaskClearCache(void);
+
+/**
+ * Indique si au moins un pixel opaque des deux masques se superpose.
+ *
+ * @param self Premier masque.
+ * @param topLeft Position du coin haut gauche de `self` dans le monde.
+ * @param other Second masque.
+ * @param otherTopLeft Position du coin haut gauche de `other` dans le monde.
+ */
+MELBoolean MELBitmapMaskIntersectsMask(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, const MELBitmapMask * _Nonnull other, MELIntPoint otherTopLeft);
+
+/**
+ * Indique si au moins un pixel opaque du masque est dans le rectangle donné.
+ *
+ * @param self Masque.
+ * @param topLeft Position du coin haut gauche de `self` dans le monde.
+ * @param rectangle Rectangle dans le monde, dont l'origine est le coin haut gauche.
+ */
+MELBoolean MELBitmapMaskIntersectsRectangle(const MELBitmapMask * _Nonnull self, MELIntPoint topLeft, MELIntRectangle rectangle);
+
+MELBoolean MELBitmapMaskGetPixel(const MELBitmapMask * _Nonnull self, int x, int y);
+
+#endif /* bitmapmask_h */
@@ -10,14 +10,34 @@
 #include "screen.h"
 #include "spritehitbox.h"
 #include "scene.h"
+#include "melmath.h"
+#include "trigtable.h"
+
+#if MELFIXED_COORDINATES
+#include "fixed.h"
+#endif
 
 typedef struct {
     MELSprite super;
     MELPoint speed;
+    MELBulletMotion motion;
+    /// Temps écoulé depuis la création du tir.
+    MELTimeInterval age;
+    /// Sinus : position sans l'oscillation. Orbit : centre de l'orbite.
+    MELPoint anchor;
+    /// Orbit : angle courant.
+    float angle;
+    /// Orbit : rayon courant.
+    float radius;
+#if MELFIXED_COORDINATES
+    /// Position en virgule fixe. Évite l'accumulation d'erreurs d'arrondi des flottants.
+    MELFixedPoint position;
+#endif
 } Bullet;
 
 static void update(LCDSprite * _Nonnull sprite);
-static void updateWithDelta(Bullet * _Nonnull self, LCDSprite * _Nonnull sprite, const float delta);
+static void moveWithDelta(Bullet * _Nonnull self, const float delta);
+static void finishUpdate(Bullet * _Nonnull self, LCDSprite * _Nonnull sprite, const float delta);
 static void save(MELSprite * _Nonnull sprite, MELOutputStream * _Nonnull outputStream);
 static MELSprite * _Nullable load(MELSpriteDefinition * _Nonnull definition, LCDSprite * _Nonnull sprite, MELInputStream * _Nonnull inputStream);
 
@@ -27,25 +47,43 @@ static const MELSpriteClass BulletClass = (MELSpriteClass) {
     .load = load,
 };
 
-LCDSprite * _Nonnull BulletConstructor(const MELShootingStyleDefinition * _Nonnull definition, MELPoint origin, MELPoint speed, float initialDelta) {
-    Bullet *self = playdate->system->realloc(NULL, sizeof(Bullet));
-    MELSpriteDefinition *bulletDefinition = definition->bulletDefinition;
+MELListImplement(MELBulletSpawn);
 
-    *self = (Bullet) {
+static LCDSprite * _Nullable (* _Nullable defaultGetTarget)(void) = NULL;
+
+
+static Bullet makeBulletTemplate(const MELShootingStyleDefinition * _Nonnull definition) {
+    MELSpriteDefinition *bulletDefinition = definition->bulletDefinition;
+    Bullet template = (Bullet) {
         .super = {
             .class = &BulletClass,
             .definition = *bulletDefinition,
             .frame = {
-                .origin = origin,
                 .size = bulletDefinition->size
             },
             .hitPoints = definition->damage,
         },
-        .speed = speed,
+        .motion = definition->motion,
+        .radius = definition->motion.radius,
     };
-    self->super.definition.type = MELSpriteTypeBullet;
+    template.super.definition.type = MELSpriteTypeBullet;
+    return template;
+}
+
+static LCDSprite * _Nonnull constructWithTemplate(const Bullet * _Nonnull template, AnimationName animationName, MELBulletSpawn spawn) {
+    Bullet *self = playdate->system->realloc(NULL, sizeof(Bullet));
+    *self = *template;
+    self->super.frame.origin = spawn.origin;
+#if MELFIXED_COORDINATES
+    self->position = MELFixedPointMakeWithPoint(spawn.origin);
+#endif
+    self->speed = spawn.speed;
+    self->anchor = spawn.origin;
+    if (self->motion.type == MELBulletMotionTypeOrbit) {
+        self->angle = MELTrigTableAtan2(spawn.speed.y, spawn.speed.x);
+    }
     self->super.hitbox = MELSpriteHitboxAlloc(&self->super);
-    MELSpriteSetAnimation(&self->super, definition->bulletAnimationName);
+    MELSpriteSetAnimation(&self->super, animationName);
 
     // TODO: Gérer les animations prévues pour un angle ?
 
@@ -60,23 +98,65 @@ LCDSprite * _Nonnull BulletConstructor(const MELShootingStyleDefinition * _Nonnu
 #endif
     MELSceneAddSprite(sprite);
 
-    updateWithDelta(self, sprite, initialDelta);
+    moveWithDelta(self, spawn.initialDelta);
+    finishUpdate(self, sprite, spawn.initialDelta);
 
     return sprite;
 }
 
+LCDSprite * _Nonnull BulletConstructor(const MELShootingStyleDefinition * _Nonnull definition, MELPoint origin, MELPoint speed, float initialDelta) {
+    const Bullet template = makeBulletTemplate(definition);
+    return constructWithTemplate(&template, definition->bulletAnimationName, (MELBulletSpawn) {
+        .origin = origin,
+        .speed = speed,
+        .initialDelta = initialDelta,
+    });
+}
+
+void BulletConstructorWithSpawns(const MELShootingStyleDefinition * _Nonnull definition, const MELBulletSpawn * _Nonnull spawns, unsigned int count) {
+    if (count == 0) {
+        return;
+    }
+    const Bullet template = makeBulletTemplate(definition);
+    const AnimationName animationName = definition->bulletAnimationName;
+    if (!currentScene->addSprite) {
+        LCDSpriteRefSlotMapReserve(&currentScene->sprites, currentScene->sprites.values.count + count);
+    }
+    for (unsigned int index = 0; index < count; index++) {
+        constructWithTemplate(&template, animationName, spawns[index]);
+    }
+}
+
 const MELSpriteClass * _Nonnull BulletGetClass(void) {
     return &BulletClass;
 }
 
+void BulletSetDefaultHomingTarget(LCDSprite * _Nullable (* _Nullable getTarget)(void)) {
+    defaultGetTarget = getTarget;
+}
+
 static void save(MELSprite * _Nonnull sprite, MELOutputStream * _Nonnull outputStream) {
     Bullet *self = (Bullet *) sprite;
     MELOutputStreamWritePoint(outputStream, self->speed);
+
+    const MELBulletMotion motion = self->motion;
+    MELOutputStreamWriteByte(outputStream, motion.type);
+    MELOutputStreamWriteFloat(outputStream, motion.acceleration);
+    MELOutputStreamWriteFloat(outputStream, motion.maxSpeed);
+    MELOutputStreamWriteFloat(outputStream, motion.turnRate);
+    MELOutputStreamWriteFloat(outputStream, motion.amplitude);
+    MELOutputStreamWriteFloat(outputStream, motion.frequency);
+    MELOutputStreamWriteFloat(outputStream, motion.angularSpeed);
+    MELOutputStreamWriteFloat(outputStream, motion.radius);
+    MELOutputStreamWriteFloat(outputStream, motion.radiusSpeed);
+
+    MELOutputStreamWriteFloat(outputStream, self->age);
+    MELOutputStreamWritePoint(outputStream, self->anchor);
+    MELOutputStreamWriteFloat(outputStream, self->angle);
+    MELOutputStreamWriteFloat(outputStream, self->radius);
 }
 
 static MELSprite * _Nullable load(MELSpriteDefinition * _Nonnull definition, LCDSprite * _Nonnull sprite, MELInputStream * _Nonnull inputStream) {
-    playdate->sprite->setUpdateFunction(sprite, update);
-
     Bullet *self = playdate->system->realloc(NULL, sizeof(Bullet));
     *self = (Bullet) {
         .super = {
@@ -84,18 +164,144 @@ static MELSprite * _Nullable load(MELSpriteDefinition * _Nonnull definition, LCD
         },
         .speed = MELInputStreamReadPoint(inputStream),
     };
+
+    // La fonction getTarget n'est pas sauvegardée : les tirs à tête chercheuse chargés visent la cible par défaut.
+    MELBulletMotion *motion = &self->motion;
+    motion->type = MELInputStreamReadByte(inputStream);
+    if (motion->type >= MELBulletMotionTypeCount) {
+        playdate->system->error("Unsupported bullet motion type: %d", motion->type);
+        motion->type = MELBulletMotionTypeLinear;
+    }
+    motion->acceleration = MELInputStreamReadFloat(inputStream);
+    motion->maxSpeed = MELInputStreamReadFloat(inputStream);
+    motion->turnRate = MELInputStreamReadFloat(inputStream);
+    motion->amplitude = MELInputStreamReadFloat(inputStream);
+    motion->frequency = MELInputStreamReadFloat(inputStream);
+    motion->angularSpeed = MELInputStreamReadFloat(inputStream);
+    motion->radius = MELInputStreamReadFloat(inputStream);
+    motion->radiusSpeed = MELInputStreamReadFloat(inputStream);
+
+    self->age = MELInputStreamReadFloat(inputStream);
+    self->anchor = MELInputStreamReadPoint(inputStream);
+    self->angle = MELInputStreamReadFloat(inputStream);
+    self->radius = MELInputStreamReadFloat(inputStream);
+
+    playdate->sprite->setUpdateFunction(sprite, update);
     return &self->super;
 }
 
-static void updateWithDelta(Bullet * _Nonnull self, LCDSprite * _Nonnull sprite, const float delta) {
+static void moveLinear(Bullet * _Nonnull self, const float delta) {
     const MELPoint speed = self->speed;
-    MELRectangle frame = self->super.frame;
-    frame.origin = (MELPoint) {
-        .x = frame.origin.x + speed.x * delta,
-        .y = frame.origin.y + speed.y * delta,
-    };
-    self->super.frame = frame;
+#if MELFIXED_COORDINATES
+    // La position a pu être modifiée directement (autre mouvement, chargement) : la virgule fixe repart de frame.origin.
+    const MELPoint origin = self->super.frame.origin;
+    if (!MELPointEquals(MELFixedPointToPoint(self->position), origin)) {
+        self->position = MELFixedPointMakeWithPoint(origin);
+    }
+    const MELFixedPoint step = MELFixedPointMake(MELFixedMakeWithFloat(speed.x * delta), MELFixedMakeWithFloat(speed.y * delta));
+    self->position = MELFixedPointAdd(self->position, step);
+    self->super.frame.origin = MELFixedPointToPoint(self->position);
+#else
+    const MELPoint origin = self->super.frame.origin;
+    self->super.frame.origin = MELPointMake(origin.x + speed.x * delta, origin.y + speed.y * delta);
+#endif
+}
+
+static void moveAccelerated(Bullet * _Nonnull self, const float delta) {
+    const MELPoint speed = self->speed;
+    const float currentSpeed = sqrtf(speed.x * speed.x + speed.y * speed.y);
+    if (currentSpeed > 0.0f) {
+        float newSpeed = MELFloatMax(currentSpeed + self->motion.acceleration * delta, 0.0f);
+        const float maxSpeed = self->motion.maxSpeed;
+        if (maxSpeed > 0.0f && newSpeed > maxSpeed) {
+            newSpeed = maxSpeed;
+        }
+        const float ratio = newSpeed / currentSpeed;
+        self->speed = MELPointMake(speed.x * ratio, speed.y * ratio);
+    }
+    moveLinear(self, delta);
+}
+
+static void moveHoming(Bullet * _Nonnull self, const float delta) {
+    LCDSprite * _Nullable (*getTarget)(void) = self->motion.getTarget ? self->motion.getTarget : defaultGetTarget;
+    LCDSprite *target = getTarget ? getTarget() : NULL;
+    if (target) {
+        const MELSprite *melTarget = playdate->sprite->getUserdata(target);
+        const MELPoint origin = self->super.frame.origin;
+        const MELPoint toTarget = MELPointSubstract(melTarget->frame.origin, origin);
+        const MELPoint speed = self->speed;
+
+        // Angle signé entre la direction du tir et la cible, limité par la vitesse de rotation.
+        const float cross = speed.x * toTarget.y - speed.y * toTarget.x;
+        const float dot = speed.x * toTarget.x + speed.y * toTarget.y;
+        const float maxRotation = self->motion.turnRate * delta;
+        const float rotation = MELFloatMin(MELFloatMax(MELTrigTableAtan2(cross, dot), -maxRotation), maxRotation);
+
+        const MELPoint direction = MELTrigTableDirection(rotation);
+        self->speed = (MELPoint) {
+            .x = speed.x * direction.x - speed.y * direction.y,
+            .y = speed.x * direction.y + speed.y * direction.x,
+        };
+    }
+    moveLinear(self, delta);
+}
+
+static void moveSinus(Bullet * _Nonnull self, const float delta) {
+    const MELPoint speed = self->speed;
+    MELPoint anchor = self->anchor;
+    anchor.x += speed.x * delta;
+    anchor.y += speed.y * delta;
+    self->anchor = anchor;
+
+    const float currentSpeed = sqrtf(speed.x * speed.x + speed.y * speed.y);
+    if (currentSpeed > 0.0f) {
+        const float offset = self->motion.amplitude * MELTrigTableSin(self->age * self->motion.frequency * MEL_2_PI) / currentSpeed;
+        anchor.x -= speed.y * offset;
+        anchor.y += speed.x * offset;
+    }
+    self->super.frame.origin = anchor;
+}
+
+static void moveOrbit(Bullet * _Nonnull self, const float delta) {
+    const MELPoint speed = self->speed;
+    MELPoint anchor = self->anchor;
+    anchor.x += speed.x * delta;
+    anchor.y += speed.y * delta;
+    self->anchor = anchor;
+
+    const float angle = self->angle + self->motion.angularSpeed * delta;
+    const float radius = self->radius + self->motion.radiusSpeed * delta;
+    self->angle = angle;
+    self->radius = radius;
+
+    const MELPoint direction = MELTrigTableDirection(angle);
+    self->super.frame.origin = MELPointMake(anchor.x + direction.x * radius, anchor.y + direction.y * radius);
+}
+
+static void moveWithDelta(Bullet * _Nonnull self, const float delta) {
+    self->age += delta;
+    switch (self->motion.type) {
+        case MELBulletMotionTypeAccelerated:
+            moveAccelerated(self, delta);
+            break;
+        case MELBulletMotionTypeHoming:
+            moveHoming(self, delta);
+            break;
+        case MELBulletMotionTypeSinus:
+            moveSinus(self, delta);
+            break;
+        case MELBulletMotionTypeOrbit:
+            moveOrbit(self, delta);
+            break;
+        default:
+            moveLinear(self, delta);
+            break;
+    }
+}
 
+static void finishUpdate(Bullet * _Nonnull self, LCDSprite * _Nonnull sprite, const float delta) {
+    MELHitboxInvalidate(self->super.hitbox);
+    const MELRectangle frame = self->super.frame;
     if (!MELRectangleIntersectsWithRectangle(frame, MELScreen)) {
         MELSpriteDealloc(sprite);
         return;
@@ -104,10 +310,13 @@ static void updateWithDelta(Bullet * _Nonnull self, LCDSprite * _Nonnull sprite,
     MELAnimation *animation = self->super.animation;
     MELAnimationUpdate(animation, delta);
 
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(frame.origin));
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->super.definition.palette, animation->frame.atlasIndex), kBitmapUnflipped);
+    MELSpritePushPosition(&self->super, sprite, frame.origin.x, frame.origin.y);
+    MELSpritePushImage(&self->super, sprite, kBitmapUnflipped);
 }
 
 static void update(LCDSprite * _Nonnull sprite) {
-    updateWithDelta(playdate->sprite->getUserdata(sprite), sprite, DELTA);
+    Bullet *self = playdate->sprite->getUserdata(sprite);
+    const float delta = DELTA;
+    moveWithDelta(self, delta);
+    finishUpdate(self, sprite, delta);
 }
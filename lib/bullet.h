@@ -13,9 +13,40 @@
 #include "shootingstyledefinition.h"
 #include "point.h"
 #include "sprite.h"
+#include "list.h"
+
+/**
+ * Paramètres de création d'un tir.
+ */
+typedef struct {
+    MELPoint origin;
+    MELPoint speed;
+    /// Temps écoulé depuis le moment où le tir aurait dû être créé.
+    float initialDelta;
+} MELBulletSpawn;
+
+MELListDefine(MELBulletSpawn);
 
 LCDSprite * _Nonnull BulletConstructor(const MELShootingStyleDefinition * _Nonnull definition, MELPoint origin, MELPoint speed, float initialDelta);
 
+/**
+ * Crée plusieurs tirs de la même définition.
+ * Les données communes à tous les tirs ne sont préparées qu'une fois.
+ *
+ * @param definition Définition du style de tir.
+ * @param spawns Paramètres de chaque tir.
+ * @param count Nombre de tirs.
+ */
+void BulletConstructorWithSpawns(const MELShootingStyleDefinition * _Nonnull definition, const MELBulletSpawn * _Nonnull spawns, unsigned int count);
+
 const MELSpriteClass * _Nonnull BulletGetClass(void);
 
+/**
+ * Définit la cible des tirs à tête chercheuse dont le mouvement n'a pas de fonction `getTarget`.
+ * Utilisée aussi par les tirs chargés depuis une sauvegarde.
+ *
+ * @param getTarget Fonction donnant la cible, ou `NULL` pour ne plus viser.
+ */
+void BulletSetDefaultHomingTarget(LCDSprite * _Nullable (* _Nullable getTarget)(void));
+
 #endif /* bullet_h */
@@ -0,0 +1,56 @@
+//
+//  bulletmotion.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef bulletmotion_h
+#define bulletmotion_h
+
+#include "melstd.h"
+
+typedef enum {
+    /// Vitesse constante.
+    MELBulletMotionTypeLinear,
+    /// La vitesse augmente (ou diminue) dans la direction du tir.
+    MELBulletMotionTypeAccelerated,
+    /// Le tir tourne vers une cible, avec une vitesse de rotation limitée.
+    MELBulletMotionTypeHoming,
+    /// Le tir oscille perpendiculairement à sa direction.
+    MELBulletMotionTypeSinus,
+    /// Le tir tourne autour de son point de départ, qui se déplace à la vitesse du tir.
+    MELBulletMotionTypeOrbit,
+    MELBulletMotionTypeCount,
+} MELBulletMotionType;
+
+/**
+ * Mouvement des tirs d'un style de tir. Seuls les champs du type choisi sont utilisés.
+ */
+typedef struct {
+    MELBulletMotionType type;
+
+    /// Accelerated : accélération en pixels par seconde².
+    float acceleration;
+    /// Accelerated : vitesse maximale. Ignorée si 0.
+    float maxSpeed;
+
+    /// Homing : vitesse de rotation maximale en radians par seconde.
+    float turnRate;
+    /// Homing : fonction donnant la cible. Si `NULL`, la cible donnée à `BulletSetDefaultHomingTarget` est utilisée.
+    LCDSprite * _Nullable (* _Nullable getTarget)(void);
+
+    /// Sinus : amplitude de l'oscillation en pixels.
+    float amplitude;
+    /// Sinus : fréquence de l'oscillation en Hz.
+    float frequency;
+
+    /// Orbit : vitesse angulaire en radians par seconde.
+    float angularSpeed;
+    /// Orbit : rayon initial.
+    float radius;
+    /// Orbit : augmentation du rayon en pixels par seconde.
+    float radiusSpeed;
+} MELBulletMotion;
+
+#endif /* bulletmotion_h */
@@ -0,0 +1,54 @@
+//
+//  bulletpattern.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "bulletpattern.h"
+
+#include "melmath.h"
+
+MELListImplement(MELBulletEmission);
+MELListImplementSort(MELBulletEmission);
+
+const MELBulletPattern MELBulletPatternEmpty = {};
+
+static int compareEmissionDelays(const MELBulletEmission * _Nonnull lhs, const MELBulletEmission * _Nonnull rhs);
+
+MELBulletEmission MELBulletEmissionMake(MELTimeInterval delay, float angle, float speed, MELPoint offset) {
+    return (MELBulletEmission) {
+        .delay = delay,
+        .direction = MELPointMake(cosf(angle), sinf(angle)),
+        .speed = speed,
+        .offset = offset,
+    };
+}
+
+void MELBulletPatternPush(MELBulletPattern * _Nonnull self, MELBulletEmission emission) {
+    if (self->count < kMELBulletPatternMaximumEmissionCount) {
+        self->emissions[self->count++] = emission;
+    }
+}
+
+void MELBulletPatternInvalidate(MELBulletPattern * _Nonnull self) {
+    self->count = 0;
+    self->isCompiled = false;
+}
+
+void MELBulletPatternSortByDelay(MELBulletPattern * _Nonnull self) {
+    if (self->count > 1) {
+        MELBulletEmissionList emissions = (MELBulletEmissionList) {
+            .memory = self->emissions,
+            .count = self->count,
+            .capacity = kMELBulletPatternMaximumEmissionCount,
+        };
+        MELBulletEmissionListSort(&emissions, compareEmissionDelays);
+    }
+}
+
+static int compareEmissionDelays(const MELBulletEmission * _Nonnull lhs, const MELBulletEmission * _Nonnull rhs) {
+    const MELTimeInterval lhsDelay = lhs->delay;
+    const MELTimeInterval rhsDelay = rhs->delay;
+    return (lhsDelay > rhsDelay) - (lhsDelay < rhsDelay);
+}
@@ -0,0 +1,80 @@
+//
+//  bulletpattern.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef bulletpattern_h
+#define bulletpattern_h
+
+#include "melstd.h"
+
+#include "point.h"
+#include "list.h"
+
+/**
+ * Tir d'une salve précalculé.
+ */
+typedef struct {
+    /// Délai entre le début de la salve et l'émission du tir.
+    MELTimeInterval delay;
+    /// Direction du tir relative à l'angle de la salve : cosinus et sinus de l'angle relatif.
+    MELPoint direction;
+    /// Vitesse du tir.
+    float speed;
+    /// Décalage de l'origine du tir, relatif à l'angle de la salve.
+    MELPoint offset;
+} MELBulletEmission;
+
+MELListDefine(MELBulletEmission);
+MELListDefineSort(MELBulletEmission);
+
+/// Nombre maximal de tirs dans une salve.
+#define kMELBulletPatternMaximumEmissionCount 64
+
+/**
+ * Table des tirs d'une salve, triée par délai.
+ *
+ * Les sinus et cosinus des angles relatifs sont calculés une seule fois à la compilation de la table.
+ * À chaque salve, seule la rotation de la salve est calculée.
+ *
+ * Les tirs sont stockés dans la structure : une table n'alloue pas de mémoire et peut être copiée.
+ */
+typedef struct {
+    MELBulletEmission emissions[kMELBulletPatternMaximumEmissionCount];
+    unsigned int count;
+    /// Nombre de tirs pour lequel la table a été compilée.
+    unsigned int bulletAmount;
+    MELBoolean isCompiled;
+} MELBulletPattern;
+
+extern const MELBulletPattern MELBulletPatternEmpty;
+
+/**
+ * Crée un tir.
+ *
+ * @param delay Délai entre le début de la salve et le tir.
+ * @param angle Angle relatif à l'angle de la salve.
+ * @param speed Vitesse du tir.
+ * @param offset Décalage de l'origine du tir.
+ * @return Un tir.
+ */
+MELBulletEmission MELBulletEmissionMake(MELTimeInterval delay, float angle, float speed, MELPoint offset);
+
+/**
+ * Ajoute un tir à la table. Le tir est ignoré si la table contient déjà `kMELBulletPatternMaximumEmissionCount` tirs.
+ */
+void MELBulletPatternPush(MELBulletPattern * _Nonnull self, MELBulletEmission emission);
+
+/**
+ * Vide la table et la marque comme non compilée.
+ */
+void MELBulletPatternInvalidate(MELBulletPattern * _Nonnull self);
+
+/**
+ * Trie la table par délai. À appeler après avoir ajouté des tirs avec un délai.
+ */
+void MELBulletPatternSortByDelay(MELBulletPattern * _Nonnull self);
+
+#endif /* bulletpattern_h */
@@ -7,15 +7,15 @@
 
 #include "burstshootingstyle.h"
 
-#include "bullet.h"
 #include "melmath.h"
 #include "random.h"
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
 
 static const MELShootingStyleClass BurstShootingStyleClass = (MELShootingStyleClass) {
     .name = MELShootingStyleClassNameBurst,
-    .createBullets = createBullets,
+    .compile = compile,
+    .isRandom = true,
 };
 
 const MELShootingStyleClass * _Nonnull BurstShootingStyleGetClass(void) {
@@ -27,23 +27,23 @@ void BurstShootingStyleInit(MELShootingStyle * _Nonnull self, const MELShootingS
         .class = &BurstShootingStyleClass,
         .definition = definition,
         .shootInterval = MELRandomFloat(definition->shootInterval),
-        .bulletAmount = definition->bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->bulletAmount),
         .bulletAmountVariation = definition->bulletAmountVariation,
         .inversionInterval = definition->inversionInterval,
+        // Jamais nul : xorshift resterait bloqué à 0.
+        .randomState = (uint32_t) MELRandomInt(INT32_MAX) + 1,
     };
 }
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
-    const MELShootingStyleDefinition *definition = self->definition;
-
-    const float bulletSpeed = definition->bulletSpeed;
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern) {
+    const float bulletSpeed = self->definition->bulletSpeed;
     const unsigned int bulletAmount = self->bulletAmount;
+
+    // Dispersion tirée de `randomState` : chaque salve est différente mais est rejouée à l'identique après un chargement.
+    uint32_t seed = self->randomState;
     for (unsigned int index = 0; index < bulletAmount; index++) {
-        const float bulletAngle = angle + MELRandomFloat(0.1f) - 0.05f;
-        const MELPoint speed = (MELPoint) {
-            .x = cosf(bulletAngle) * bulletSpeed,
-            .y = sinf(bulletAngle) * bulletSpeed
-        };
-        BulletConstructor(definition, origin, speed, initialDelta);
+        seed = seed * 1664525u + 1013904223u;
+        const float spread = (seed >> 8) * (0.1f / 16777216.0f) - 0.05f;
+        MELBulletPatternPush(pattern, MELBulletEmissionMake(0.0f, spread, bulletSpeed, MELPointZero));
     }
 }
@@ -9,6 +9,7 @@
 
 #include "sprite.h"
 #include "melmath.h"
+#include "easingtable.h"
 #include "random.h"
 
 MELCamera camera = (MELCamera) {
@@ -46,7 +47,7 @@ const MELSpriteClass * _Nonnull MELCameraShakeGetClass(void) {
 static void updateShaking(LCDSprite * _Nonnull sprite) {
     MELCameraShake *self = playdate->sprite->getUserdata(sprite);
     const float time = self->time += DELTA;
-    const float progress = MELEaseInOut(0, self->duration, time);
+    const float progress = MELEaseInOutTabulated(0, self->duration, time);
     const float intensity = (1.0f - progress) * self->intensity;
     MELPoint oldTranslation = self->oldTranslation;
     MELPoint translation = (MELPoint) {
@@ -0,0 +1,78 @@
+//
+//  capsulehitbox.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "capsulehitbox.h"
+
+#include "hitboxtype.h"
+#include "sprite.h"
+#include "melmath.h"
+
+static MELRectangle getFrame(MELCapsuleHitbox * _Nonnull self) {
+    const MELSegment segment = MELCapsuleHitboxGetSegment(self);
+    const float radius = self->radius;
+    const float left = MELFloatMin(segment.from.x, segment.to.x) - radius;
+    const float right = MELFloatMax(segment.from.x, segment.to.x) + radius;
+    const float top = MELFloatMin(segment.from.y, segment.to.y) - radius;
+    const float bottom = MELFloatMax(segment.from.y, segment.to.y) + radius;
+    return (MELRectangle) {
+        .origin = {(left + right) / 2, (top + bottom) / 2},
+        .size = {right - left, bottom - top}
+    };
+}
+
+static void save(MELCapsuleHitbox * _Nonnull self, MELOutputStream * _Nonnull outputStream) {
+    MELOutputStreamWriteByte(outputStream, MELHitboxTypeCapsuleHitbox);
+    MELOutputStreamWriteBoolean(outputStream, self->sprite != NULL);
+    MELOutputStreamWritePoint(outputStream, self->segment.from);
+    MELOutputStreamWritePoint(outputStream, self->segment.to);
+    MELOutputStreamWriteFloat(outputStream, self->radius);
+}
+
+const MELHitboxClass MELCapsuleHitboxClass = {
+    .getFrame = (MELRectangle(*)(MELHitbox *)) getFrame,
+    .save = (void(*)(MELHitbox *, MELOutputStream *)) save,
+};
+
+MELHitbox * _Nonnull MELCapsuleHitboxAlloc(MELSprite * _Nullable sprite, MELSegment segment, float radius) {
+    MELCapsuleHitbox *self = malloc(sizeof(MELCapsuleHitbox));
+    *self = (MELCapsuleHitbox) {
+        .super = (MELHitbox) {
+            .class = &MELCapsuleHitboxClass
+        },
+        .sprite = sprite,
+        .segment = segment,
+        .radius = radius
+    };
+    return (MELHitbox *)self;
+}
+
+MELHitbox * _Nonnull MELCapsuleHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite) {
+    const MELBoolean isAttachedToSprite = MELInputStreamReadBoolean(inputStream);
+    MELSegment segment;
+    segment.from = MELInputStreamReadPoint(inputStream);
+    segment.to = MELInputStreamReadPoint(inputStream);
+    const float radius = MELInputStreamReadFloat(inputStream);
+    return MELCapsuleHitboxAlloc(isAttachedToSprite ? sprite : NULL, segment, radius);
+}
+
+void MELCapsuleHitboxSetSegment(MELCapsuleHitbox * _Nonnull self, MELSegment segment) {
+    self->segment = segment;
+    MELHitboxInvalidate(&self->super);
+}
+
+MELSegment MELCapsuleHitboxGetSegment(MELCapsuleHitbox * _Nonnull self) {
+    const MELSprite *sprite = self->sprite;
+    if (sprite == NULL) {
+        return self->segment;
+    }
+    const MELPoint origin = sprite->frame.origin;
+    const float direction = MELDirectionValues[sprite->direction];
+    return (MELSegment) {
+        .from = {origin.x + self->segment.from.x * direction, origin.y + self->segment.from.y},
+        .to = {origin.x + self->segment.to.x * direction, origin.y + self->segment.to.y},
+    };
+}
@@ -0,0 +1,42 @@
+//
+//  capsulehitbox.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef capsulehitbox_h
+#define capsulehitbox_h
+
+#include "hitbox.h"
+#include "segment.h"
+
+extern const MELHitboxClass MELCapsuleHitboxClass;
+
+typedef struct melsprite MELSprite;
+
+/**
+ * Ensemble des points à une distance de `radius` ou moins de `segment`.
+ * Un rayon de 0 donne un simple segment, pratique pour les rayons laser.
+ *
+ * Si `sprite` est défini, les extrémités du segment sont relatives à l'origine du sprite et la hitbox est retournée
+ * horizontalement lorsque le sprite regarde vers la gauche. Sinon, le segment est en coordonnées du monde.
+ */
+typedef struct {
+    MELHitbox super;
+    MELSprite * _Nullable sprite;
+    MELSegment segment;
+    float radius;
+} MELCapsuleHitbox;
+
+MELHitbox * _Nonnull MELCapsuleHitboxAlloc(MELSprite * _Nullable sprite, MELSegment segment, float radius);
+MELHitbox * _Nonnull MELCapsuleHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite);
+
+void MELCapsuleHitboxSetSegment(MELCapsuleHitbox * _Nonnull self, MELSegment segment);
+
+/**
+ * Retourne le segment en coordonnées du monde.
+ */
+MELSegment MELCapsuleHitboxGetSegment(MELCapsuleHitbox * _Nonnull self);
+
+#endif /* capsulehitbox_h */
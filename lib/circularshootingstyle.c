@@ -7,15 +7,16 @@
 
 #include "circularshootingstyle.h"
 
-#include "bullet.h"
 #include "melmath.h"
 #include "random.h"
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle);
 
 static const MELShootingStyleClass CircularShootingStyleClass = (MELShootingStyleClass) {
     .name = MELShootingStyleClassNameCircular,
-    .createBullets = createBullets,
+    .compile = compile,
+    .volleyAngle = volleyAngle,
 };
 
 const MELShootingStyleClass * _Nonnull CircularShootingStyleGetClass(void) {
@@ -27,32 +28,33 @@ void CircularShootingStyleInit(MELShootingStyle * _Nonnull self, const CircularS
         .class = &CircularShootingStyleClass,
         .definition = &definition->super,
         .shootInterval = MELRandomFloat(definition->super.shootInterval),
-        .bulletAmount = definition->super.bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->super.bulletAmount),
         .bulletAmountVariation = definition->super.bulletAmountVariation,
         .inversionInterval = definition->super.inversionInterval,
         .baseAngle = definition->baseAngle,
     };
 }
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
-    CircularShootingStyleDefinition *definition = (CircularShootingStyleDefinition *) self->definition;
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern) {
+    const CircularShootingStyleDefinition *definition = (const CircularShootingStyleDefinition *) self->definition;
 
     const float bulletSpeed = definition->super.bulletSpeed;
-    const float baseAngle = self->baseAngle;
-    self->baseAngle = baseAngle + definition->baseAngleVariation;
-    angle += baseAngle;
-
     const unsigned int bulletAmount = self->bulletAmount;
     float angleIncrement = definition->angleIncrement;
     if (!angleIncrement) {
         angleIncrement = MEL_2_PI / bulletAmount;
     }
 
+    float angle = 0.0f;
     for (unsigned int index = 0; index < bulletAmount; index++) {
-        BulletConstructor(&definition->super, origin, (MELPoint) {
-            .x = cosf(angle) * bulletSpeed,
-            .y = sinf(angle) * bulletSpeed,
-        }, initialDelta);
+        MELBulletPatternPush(pattern, MELBulletEmissionMake(0.0f, angle, bulletSpeed, MELPointZero));
         angle += angleIncrement;
     }
 }
+
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle) {
+    const CircularShootingStyleDefinition *definition = (const CircularShootingStyleDefinition *) self->definition;
+    const float baseAngle = self->baseAngle;
+    self->baseAngle = baseAngle + definition->baseAngleVariation;
+    return angle + baseAngle;
+}
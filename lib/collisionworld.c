@@ -0,0 +1,214 @@
+//
+//  collisionworld.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "collisionworld.h"
+
+#include "hitbox.h"
+
+MELListImplement(MELCollisionPair);
+MELListImplementSort(MELCollisionPair);
+
+typedef enum {
+    MELCollisionEventEnter,
+    MELCollisionEventStay,
+    MELCollisionEventExit,
+} MELCollisionEvent;
+
+static int comparePairs(const MELCollisionPair * _Nonnull lhs, const MELCollisionPair * _Nonnull rhs);
+static MELRectangle rectangleWithBoundingBox(MELBoundingBox boundingBox);
+static void findPairs(MELCollisionWorld * _Nonnull self, LCDSpriteRefList sprites);
+static void dispatchEvents(MELCollisionWorld * _Nonnull self);
+static void dispatch(MELCollisionWorld * _Nonnull self, MELCollisionPair pair, MELCollisionEvent event);
+static MELBoolean isRemoved(MELCollisionWorld * _Nonnull self, LCDSprite * _Nonnull sprite);
+static void removePairsWithSprites(MELCollisionWorld * _Nonnull self, MELCollisionPairList * _Nonnull pairs);
+
+MELCollisionWorld * _Nonnull MELCollisionWorldAlloc(void) {
+    MELCollisionWorld *self = playdate->system->realloc(NULL, sizeof(MELCollisionWorld));
+    *self = (MELCollisionWorld) {
+        .geoMap = MELGeoMapAlloc(),
+        .iterator = MELGeoMapIteratorAlloc(),
+        .candidates = LCDSpriteRefListEmpty,
+        .frames = MELRectangleListEmpty,
+        .pairs = MELCollisionPairListMake(),
+        .newPairs = MELCollisionPairListMake(),
+        .removedSprites = MELPointerMELBooleanTableEmpty,
+    };
+    return self;
+}
+
+void MELCollisionWorldDealloc(MELCollisionWorld * _Nonnull self) {
+    MELGeoMapDeinit(self->geoMap);
+    playdate->system->realloc(self->geoMap, 0);
+    MELGeoMapIteratorDealloc(self->iterator);
+    LCDSpriteRefListDeinit(&self->candidates);
+    MELRectangleListDeinit(&self->frames);
+    MELCollisionPairListDeinit(&self->pairs);
+    MELCollisionPairListDeinit(&self->newPairs);
+    MELPointerMELBooleanTableDeinit(&self->removedSprites);
+    playdate->system->realloc(self, 0);
+}
+
+void MELCollisionWorldUpdate(MELCollisionWorld * _Nonnull self, LCDSpriteRefList sprites) {
+    findPairs(self, sprites);
+
+    self->isDispatching = true;
+    dispatchEvents(self);
+    self->isDispatching = false;
+
+    if (self->removedSprites.count > 0) {
+        removePairsWithSprites(self, &self->newPairs);
+        MELPointerMELBooleanTableClear(&self->removedSprites);
+    }
+
+    MELCollisionPairList oldPairs = self->pairs;
+    self->pairs = self->newPairs;
+    self->newPairs = oldPairs;
+    MELCollisionPairListClear(&self->newPairs);
+}
+
+void MELCollisionWorldRemoveSprite(MELCollisionWorld * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELPointerMELBooleanTablePut(&self->removedSprites, (MELPointer) sprite, true);
+    if (!self->isDispatching) {
+        removePairsWithSprites(self, &self->pairs);
+        MELPointerMELBooleanTableClear(&self->removedSprites);
+    }
+}
+
+static int comparePairs(const MELCollisionPair * _Nonnull a, const MELCollisionPair * _Nonnull b) {
+    if (a->first != b->first) {
+        return (MELPointer) a->first < (MELPointer) b->first ? -1 : 1;
+    } else if (a->second != b->second) {
+        return (MELPointer) a->second < (MELPointer) b->second ? -1 : 1;
+    }
+    return 0;
+}
+
+static MELRectangle rectangleWithBoundingBox(MELBoundingBox boundingBox) {
+    return (MELRectangle) {
+        .origin = {
+            .x = (boundingBox.left + boundingBox.right) / 2.0f,
+            .y = (boundingBox.top + boundingBox.bottom) / 2.0f,
+        },
+        .size = {
+            .width = boundingBox.right - boundingBox.left,
+            .height = boundingBox.bottom - boundingBox.top,
+        },
+    };
+}
+
+static void findPairs(MELCollisionWorld * _Nonnull self, LCDSpriteRefList sprites) {
+    MELHitboxNextFrame();
+    LCDSpriteRefList *candidates = &self->candidates;
+    MELRectangleList *frames = &self->frames;
+    LCDSpriteRefListClear(candidates);
+    MELRectangleListClear(frames);
+    for (unsigned int index = 0; index < sprites.count; index++) {
+        LCDSprite *sprite = sprites.memory[index];
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+        if (melSprite->hitbox != NULL && melSprite->cullingState != MELSpriteCullingStateAsleep) {
+            LCDSpriteRefListPush(candidates, sprite);
+            MELRectangleListPush(frames, rectangleWithBoundingBox(MELHitboxGetBoundingBox(melSprite->hitbox)));
+        }
+    }
+    // Les sprites sont rangés et cherchés avec le même rectangle : deux boîtes qui se touchent partagent
+    // toujours une cellule, quel que soit le sprite depuis lequel la paire est cherchée.
+    MELGeoMapRebuildWithFrames(self->geoMap, *candidates, *frames);
+
+    MELGeoMapIterator *iterator = self->iterator;
+    MELCollisionPairList *pairs = &self->newPairs;
+    MELCollisionPairListClear(pairs);
+
+    for (unsigned int index = 0; index < candidates->count; index++) {
+        LCDSprite *sprite = candidates->memory[index];
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+        if (MELSpriteDefinitionGetCollisionMask(&melSprite->definition) == 0) {
+            continue;
+        }
+        const MELBoundingBox boundingBox = MELHitboxGetBoundingBox(melSprite->hitbox);
+        MELGeoMapSpritesInRectangleWithIterator(self->geoMap, frames->memory[index], iterator, MELPointerListEmpty);
+        while (MELGeoMapIteratorHasNext(iterator)) {
+            LCDSprite *otherSprite = MELGeoMapIteratorNext(iterator);
+            // Chaque paire n'est testée qu'une fois, depuis le sprite ayant la plus petite adresse.
+            if ((MELPointer) otherSprite <= (MELPointer) sprite) {
+                continue;
+            }
+            MELSprite *other = playdate->sprite->getUserdata(otherSprite);
+            if (MELSpriteDefinitionCanCollideWith(&melSprite->definition, &other->definition)
+                && MELBoundingBoxIntersects(boundingBox, MELHitboxGetBoundingBox(other->hitbox))
+                && MELHitboxCollidesWithHitboxPrecisely(melSprite->hitbox, other->hitbox)) {
+                MELCollisionPairListPush(pairs, (MELCollisionPair) {
+                    .first = sprite,
+                    .second = otherSprite,
+                });
+            }
+        }
+    }
+    MELCollisionPairListSort(pairs, comparePairs);
+}
+
+static void dispatchEvents(MELCollisionWorld * _Nonnull self) {
+    // Les deux listes sont triées : une seule passe suffit pour distinguer les nouvelles paires, les paires
+    // toujours en contact et les paires séparées.
+    const MELCollisionPairList oldPairs = self->pairs;
+    const MELCollisionPairList newPairs = self->newPairs;
+    unsigned int oldIndex = 0;
+    unsigned int newIndex = 0;
+    while (oldIndex < oldPairs.count || newIndex < newPairs.count) {
+        const int comparison = oldIndex == oldPairs.count ? 1
+            : newIndex == newPairs.count ? -1
+            : comparePairs(oldPairs.memory + oldIndex, newPairs.memory + newIndex);
+        if (comparison < 0) {
+            dispatch(self, oldPairs.memory[oldIndex++], MELCollisionEventExit);
+        } else if (comparison > 0) {
+            dispatch(self, newPairs.memory[newIndex++], MELCollisionEventEnter);
+        } else {
+            dispatch(self, newPairs.memory[newIndex++], MELCollisionEventStay);
+            oldIndex++;
+        }
+    }
+}
+
+static void dispatch(MELCollisionWorld * _Nonnull self, MELCollisionPair pair, MELCollisionEvent event) {
+    LCDSprite *sprites[2] = {pair.first, pair.second};
+    for (int index = 0; index < 2; index++) {
+        LCDSprite *sprite = sprites[index];
+        LCDSprite *other = sprites[1 - index];
+        if (isRemoved(self, sprite) || isRemoved(self, other)) {
+            return;
+        }
+        const MELSpriteClass *class = LCDSpriteGetClass(sprite);
+        void (*callback)(LCDSprite * _Nonnull, LCDSprite * _Nonnull) = NULL;
+        switch (event) {
+            case MELCollisionEventEnter:
+                callback = class->collisionEnter;
+                break;
+            case MELCollisionEventStay:
+                callback = class->collisionStay;
+                break;
+            case MELCollisionEventExit:
+                callback = class->collisionExit;
+                break;
+        }
+        if (callback != NULL) {
+            callback(sprite, other);
+        }
+    }
+}
+
+static MELBoolean isRemoved(MELCollisionWorld * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    return self->removedSprites.count > 0 && MELPointerMELBooleanTableContains(self->removedSprites, (MELPointer) sprite);
+}
+
+static MELBoolean isPairRemoved(MELCollisionPair * _Nonnull pair, void * _Nullable userdata) {
+    MELCollisionWorld *self = userdata;
+    return isRemoved(self, pair->first) || isRemoved(self, pair->second);
+}
+
+static void removePairsWithSprites(MELCollisionWorld * _Nonnull self, MELCollisionPairList * _Nonnull pairs) {
+    // Suppression en conservant l'ordre des paires.
+    MELCollisionPairListRemoveIf(pairs, isPairRemoved, self);
+}
@@ -0,0 +1,74 @@
+//
+//  collisionworld.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef collisionworld_h
+#define collisionworld_h
+
+#include "melstd.h"
+
+#include "sprite.h"
+#include "geomap.h"
+#include "list.h"
+#include "lcdspriteref.h"
+
+/**
+ * Paire de sprites en contact. `first` est toujours l'adresse la plus petite.
+ */
+typedef struct {
+    LCDSprite * _Nonnull first;
+    LCDSprite * _Nonnull second;
+} MELCollisionPair;
+
+MELListDefine(MELCollisionPair);
+MELListDefineSort(MELCollisionPair);
+
+/**
+ * Détecte les collisions entre les sprites d'une scène et envoie les évènements
+ * `collisionEnter`, `collisionStay` et `collisionExit` aux classes des sprites.
+ */
+typedef struct melcollisionworld {
+    MELGeoMap * _Nonnull geoMap;
+    MELGeoMapIterator * _Nonnull iterator;
+    /// Sprites ayant une hitbox active pendant la mise à jour en cours.
+    LCDSpriteRefList candidates;
+    /// Boîte englobante de la hitbox de chaque candidat, sous forme de rectangle.
+    MELRectangleList frames;
+    /// Paires en contact à la dernière mise à jour, triées.
+    MELCollisionPairList pairs;
+    /// Paires en contact pendant la mise à jour en cours.
+    MELCollisionPairList newPairs;
+    /// Sprites désalloués pendant l'envoi des évènements.
+    MELPointerMELBooleanTable removedSprites;
+    MELBoolean isDispatching;
+} MELCollisionWorld;
+
+MELCollisionWorld * _Nonnull MELCollisionWorldAlloc(void);
+void MELCollisionWorldDealloc(MELCollisionWorld * _Nonnull self);
+
+/**
+ * Cherche les paires de sprites en contact et envoie les évènements de collision.
+ *
+ * Les candidats sont cherchés dans une `MELGeoMap` reconstruite à chaque appel avec les boîtes englobantes
+ * des hitbox, filtrés par catégorie et masque
+ * de collision (voir `MELSpriteDefinitionCanCollideWith`) puis testés avec les boîtes englobantes des hitbox.
+ * Chaque paire n'est signalée qu'une fois par mise à jour, aux deux sprites concernés.
+ *
+ * @param self Monde de collision.
+ * @param sprites Sprites à tester, généralement `scene->sprites.values`.
+ */
+void MELCollisionWorldUpdate(MELCollisionWorld * _Nonnull self, LCDSpriteRefList sprites);
+
+/**
+ * Oublie les paires du sprite donné sans envoyer d'évènement `collisionExit`.
+ * Appelé par `MELSpriteDealloc` lorsque la scène courante a un monde de collision.
+ *
+ * @param self Monde de collision.
+ * @param sprite Sprite en cours de désallocation.
+ */
+void MELCollisionWorldRemoveSprite(MELCollisionWorld * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+#endif /* collisionworld_h */
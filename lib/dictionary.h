@@ -13,155 +13,193 @@
 #include <string.h>
 #include "list.h"
 #include "melstring.h"
+#include "atom.h"
 
-#define LOAD_FACTOR 0.75
-#define DEFAULT_BUCKET_COUNT 16
+/// Capacité minimale d'un dictionnaire. Toujours une puissance de 2.
+#define MELDictionaryMinimumCapacity 16
+
+/// Un dictionnaire est agrandi dès qu'il est rempli aux 3/4.
+#define MELDictionaryIsOverloaded(count, capacity) ((count) * 4 > (capacity) * 3)
 
 // Definition macro
 
 #define MELDictionaryDefine(type) typedef struct {\
-uint64_t hash;\
+    /** Hash of the key. */\
+    uint32_t hash;\
+    /** Key of the entry. NULL when the slot is empty. */\
     char * _Nullable key;\
     type value;\
 } type##DictionaryEntry;\
 \
 MELListDefine(type##DictionaryEntry);\
 \
-typedef struct {\
-    MELList(type##DictionaryEntry) entries;\
-} type##DictionaryBucket;\
-\
-MELListDefine(type##DictionaryBucket);\
-\
-/** Dictionary with string keys and type values. */ typedef struct {\
-    MELList(type##DictionaryBucket) buckets;\
+/** Dictionary with string keys and type values. Open addressing with Robin Hood hashing: every entry lives in `entries`. */ typedef struct {\
+    /** Slots of the dictionary. `capacity` is always 0 or a power of 2. */\
+    type##DictionaryEntry * _Nullable entries;\
+    unsigned int capacity;\
     unsigned int count;\
+    /** When true, keys are not copied: they must outlive the dictionary (literals, interned strings). */\
+    MELBoolean borrowsKeys;\
 } type##Dictionary;\
 \
 extern const type##Dictionary type##DictionaryEmpty;\
+type##Dictionary type##DictionaryMakeWithBorrowedKeys(void);\
 void type##DictionaryDeinit(type##Dictionary * _Nonnull self);\
+/** Grows the dictionary so that it holds count entries without rehashing. */\
+void type##DictionaryReserve(type##Dictionary * _Nonnull self, unsigned int count);\
 type type##DictionaryPut(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value);\
 MELBoolean type##DictionaryPutAndGetOldValue(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value, type * _Nullable oldValue);\
 type type##DictionaryGet(type##Dictionary self, const char * _Nonnull key);\
 MELBoolean type##DictionaryGetIfPresent(type##Dictionary self, const char * _Nonnull key, type * _Nonnull value);\
+/** Same as Put but uses the hash cached in the atom. */\
+type type##DictionaryPutWithAtom(type##Dictionary * _Nonnull self, MELAtom _Nonnull key, type value);\
+/** Same as Get but uses the hash cached in the atom. With borrowed keys, the key is found by pointer comparison. */\
+type type##DictionaryGetWithAtom(type##Dictionary self, MELAtom _Nonnull key);\
+MELBoolean type##DictionaryGetIfPresentWithAtom(type##Dictionary self, MELAtom _Nonnull key, type * _Nonnull value);\
 type type##DictionaryRemove(type##Dictionary * _Nonnull self, const char * _Nonnull key);\
 type##DictionaryEntryList type##DictionaryEntries(type##Dictionary * _Nonnull self);
 
 // Implementation macro
 
-#define MELDictionaryImplement(type, nil) const type##Dictionary type##DictionaryEmpty = {{NULL, 0, 0}, 0};\
+#define MELDictionaryImplement(type, nil) const type##Dictionary type##DictionaryEmpty = {NULL, 0, 0, false};\
 \
-MELListImplement(type##DictionaryBucket);\
 MELListImplement(type##DictionaryEntry);\
 \
-void type##DictionaryEntryDeinit(type##DictionaryEntry * _Nonnull self) {\
-    playdate->system->realloc(self->key, 0);\
-    self->key = NULL;\
+type##Dictionary type##DictionaryMakeWithBorrowedKeys(void) {\
+    return (type##Dictionary) {\
+        .borrowsKeys = true,\
+    };\
 }\
 \
 void type##DictionaryDeinit(type##Dictionary * _Nonnull self) {\
-    for (unsigned int bucketIndex = 0; bucketIndex < self->buckets.capacity; bucketIndex++) {\
-        type##DictionaryBucket bucket = self->buckets.memory[bucketIndex];\
-        if (bucket.entries.memory != NULL) {\
-            type##DictionaryEntryListDeinitWithDeinitFunction(&self->buckets.memory[bucketIndex].entries, &type##DictionaryEntryDeinit);\
+    if (!self->borrowsKeys) {\
+        for (unsigned int index = 0; index < self->capacity; index++) {\
+            playdate->system->realloc(self->entries[index].key, 0);\
         }\
     }\
-    type##DictionaryBucketListDeinit(&self->buckets);\
+    playdate->system->realloc(self->entries, 0);\
+    self->entries = NULL;\
+    self->capacity = 0;\
     self->count = 0;\
 }\
 \
-void type##DictionaryGrowAndRehash(type##Dictionary * _Nonnull self) {\
-    type##DictionaryBucketList oldBuckets = self->buckets;\
-    const unsigned int newCapacity = oldBuckets.capacity == 0 ? DEFAULT_BUCKET_COUNT : oldBuckets.capacity * 2;\
-    type##DictionaryBucketList newBuckets = type##DictionaryBucketListMakeWithInitialCapacity(newCapacity);\
-    if (newBuckets.memory == NULL) {\
-        playdate->system->error("Unable to grow dictionary of type to capacity %lu\n", newCapacity);\
-        return;\
-    }\
-    memset(newBuckets.memory, 0, sizeof(type##DictionaryBucketList) * newBuckets.capacity);\
-    newBuckets.count = oldBuckets.count;\
-    for (unsigned int bucketIndex = 0; bucketIndex < oldBuckets.capacity; bucketIndex++) {\
-        type##DictionaryBucket oldBucket = oldBuckets.memory[bucketIndex];\
-        for (unsigned int entryIndex = 0; entryIndex < oldBucket.entries.count; entryIndex++) {\
-            type##DictionaryEntry entry = oldBucket.entries.memory[entryIndex];\
-\
-            unsigned int newBucketIndex = entry.hash % newBuckets.capacity;\
-            type##DictionaryEntryListPush(&newBuckets.memory[newBucketIndex].entries, entry);\
+/** Distance between the given slot and the slot where an entry with the given hash should be. */\
+unsigned int type##DictionaryProbeDistance(uint32_t hash, unsigned int index, unsigned int mask) {\
+    return (index - (hash & mask)) & mask;\
+}\
+\
+/** Inserts an entry whose key is not in the dictionary yet. The dictionary must have a free slot. */\
+void type##DictionaryInsertEntry(type##DictionaryEntry * _Nonnull entries, unsigned int mask, type##DictionaryEntry entry) {\
+    unsigned int index = entry.hash & mask;\
+    unsigned int distance = 0;\
+    while (entries[index].key != NULL) {\
+        const unsigned int existingDistance = type##DictionaryProbeDistance(entries[index].hash, index, mask);\
+        if (existingDistance < distance) {\
+            /* Robin Hood : l'entrée la plus éloignée de sa place prend la case. */\
+            const type##DictionaryEntry swap = entries[index];\
+            entries[index] = entry;\
+            entry = swap;\
+            distance = existingDistance;\
         }\
-        type##DictionaryEntryListDeinit(&oldBucket.entries);\
+        index = (index + 1) & mask;\
+        distance++;\
     }\
-    self->buckets = newBuckets;\
-    type##DictionaryBucketListDeinit(&oldBuckets);\
+    entries[index] = entry;\
 }\
 \
-type type##DictionaryPut(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value) {\
-    if (self->buckets.capacity == 0 || self->buckets.memory == NULL) {\
-        type##DictionaryGrowAndRehash(self);\
-        if (self->buckets.capacity == 0 || self->buckets.memory == NULL) {\
-            return nil;\
-        }\
+void type##DictionaryRehash(type##Dictionary * _Nonnull self, unsigned int newCapacity) {\
+    type##DictionaryEntry *newEntries = playdate->system->realloc(NULL, sizeof(type##DictionaryEntry) * newCapacity);\
+    if (newEntries == NULL) {\
+        playdate->system->error("Unable to grow dictionary of type to capacity %u\n", newCapacity);\
+        return;\
     }\
-    const uint64_t hash = MELStringHash(key);\
-    const unsigned int bucketIndex = hash % self->buckets.capacity;\
-    type##DictionaryBucket bucket = self->buckets.memory[bucketIndex];\
-    if (bucket.entries.count > 0 && bucket.entries.memory != NULL) {\
-        for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-            type##DictionaryEntry entry = bucket.entries.memory[entryIndex];\
-            if (entry.hash == hash && (entry.key == key || MELStringEquals(entry.key, key))) {\
-                type oldValue = entry.value;\
-                entry.value = value;\
-                return oldValue;\
-            }\
+    memset(newEntries, 0, sizeof(type##DictionaryEntry) * newCapacity);\
+    const unsigned int newMask = newCapacity - 1;\
+    type##DictionaryEntry *oldEntries = self->entries;\
+    for (unsigned int index = 0; index < self->capacity; index++) {\
+        if (oldEntries[index].key != NULL) {\
+            type##DictionaryInsertEntry(newEntries, newMask, oldEntries[index]);\
         }\
     }\
-    if (bucket.entries.count == 0 || bucket.entries.memory == NULL) {\
-        self->buckets.count++;\
-    }\
-    self->count++;\
-    char *keyCopy = strdup(key);\
-    type##DictionaryEntryListPush(&self->buckets.memory[bucketIndex].entries, (type##DictionaryEntry) {hash, keyCopy, value});\
+    playdate->system->realloc(oldEntries, 0);\
+    self->entries = newEntries;\
+    self->capacity = newCapacity;\
+}\
 \
-    const double loadFactor = self->count / (double) self->buckets.capacity;\
-    if (loadFactor >= LOAD_FACTOR) {\
-        type##DictionaryGrowAndRehash(self);\
+void type##DictionaryReserve(type##Dictionary * _Nonnull self, unsigned int count) {\
+    unsigned int capacity = self->capacity == 0 ? MELDictionaryMinimumCapacity : self->capacity;\
+    while (MELDictionaryIsOverloaded(count, capacity)) {\
+        capacity *= 2;\
+    }\
+    if (capacity != self->capacity) {\
+        type##DictionaryRehash(self, capacity);\
     }\
-    return nil;\
 }\
 \
-MELBoolean type##DictionaryPutAndGetOldValue(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value, type * _Nullable oldValue) {\
-    if (self->buckets.capacity == 0 || self->buckets.memory == NULL) {\
-        type##DictionaryGrowAndRehash(self);\
-        if (!self->buckets.capacity) {\
-            /* Unable to put the value. */\
-            return false;\
+int type##DictionaryIndexOfKey(const type##Dictionary * _Nonnull self, const char * _Nonnull key, uint32_t hash) {\
+    if (self->entries == NULL) {\
+        return -1;\
+    }\
+    const unsigned int mask = self->capacity - 1;\
+    unsigned int index = hash & mask;\
+    for (unsigned int distance = 0; distance <= mask; distance++) {\
+        const type##DictionaryEntry entry = self->entries[index];\
+        if (entry.key == NULL || type##DictionaryProbeDistance(entry.hash, index, mask) < distance) {\
+            return -1;\
+        }\
+        if (entry.hash == hash && (entry.key == key || MELStringEquals(entry.key, key))) {\
+            return (int) index;\
         }\
+        index = (index + 1) & mask;\
     }\
-    const uint64_t hash = MELStringHash(key);\
-    const unsigned int bucketIndex = hash % self->buckets.capacity;\
-    type##DictionaryBucket bucket = self->buckets.memory[bucketIndex];\
-    if (bucket.entries.count > 0 && bucket.entries.memory != NULL) {\
-        for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-            type##DictionaryEntry entry = bucket.entries.memory[entryIndex];\
-            if (entry.hash == hash && (entry.key == key || MELStringEquals(entry.key, key))) {\
-                if (oldValue) {\
-                    *oldValue = entry.value;\
-                }\
-                entry.value = value;\
-                return true;\
-            }\
+    return -1;\
+}\
+\
+MELBoolean type##DictionaryPutWithHash(type##Dictionary * _Nonnull self, const char * _Nonnull key, uint32_t hash, type value, type * _Nullable oldValue) {\
+    const int existingIndex = type##DictionaryIndexOfKey(self, key, hash);\
+    if (existingIndex >= 0) {\
+        type##DictionaryEntry *entry = self->entries + existingIndex;\
+        if (oldValue) {\
+            *oldValue = entry->value;\
         }\
+        entry->value = value;\
+        return true;\
     }\
-    if (bucket.entries.count == 0 || bucket.entries.memory == NULL) {\
-        self->buckets.count++;\
+    if (self->capacity == 0 || MELDictionaryIsOverloaded(self->count + 1, self->capacity)) {\
+        type##DictionaryReserve(self, self->count + 1);\
+        if (self->entries == NULL) {\
+            /* Unable to put the value. */\
+            return false;\
+        }\
     }\
+    char *keyCopy = self->borrowsKeys ? (char *) key : MELStringCopy(key);\
+    type##DictionaryInsertEntry(self->entries, self->capacity - 1, (type##DictionaryEntry) {hash, keyCopy, value});\
     self->count++;\
-    char *keyCopy = strdup(key);\
-    type##DictionaryEntryListPush(&self->buckets.memory[bucketIndex].entries, (type##DictionaryEntry) {hash, keyCopy, value});\
+    return true;\
+}\
+\
+type type##DictionaryPut(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value) {\
+    type oldValue = nil;\
+    type##DictionaryPutAndGetOldValue(self, key, value, &oldValue);\
+    return oldValue;\
+}\
+\
+MELBoolean type##DictionaryPutAndGetOldValue(type##Dictionary * _Nonnull self, const char * _Nonnull key, type value, type * _Nullable oldValue) {\
+    return type##DictionaryPutWithHash(self, key, MELStringHash(key), value, oldValue);\
+}\
 \
-    const double loadFactor = self->count / (double) self->buckets.capacity;\
-    if (loadFactor >= LOAD_FACTOR) {\
-        type##DictionaryGrowAndRehash(self);\
+type type##DictionaryPutWithAtom(type##Dictionary * _Nonnull self, MELAtom _Nonnull key, type value) {\
+    type oldValue = nil;\
+    type##DictionaryPutWithHash(self, key, MELAtomGetHash(key), value, &oldValue);\
+    return oldValue;\
+}\
+\
+MELBoolean type##DictionaryGetIfPresentWithHash(const type##Dictionary * _Nonnull self, const char * _Nonnull key, uint32_t hash, type * _Nonnull value) {\
+    const int index = type##DictionaryIndexOfKey(self, key, hash);\
+    if (index < 0) {\
+        return false;\
     }\
+    *value = self->entries[index].value;\
     return true;\
 }\
 \
@@ -173,51 +211,49 @@ type type##DictionaryGet(type##Dictionary self, const char * _Nonnull key) {\
 }\
 \
 MELBoolean type##DictionaryGetIfPresent(type##Dictionary self, const char * _Nonnull key, type * _Nonnull value) {\
-    if (self.buckets.memory == 0 || self.buckets.memory == NULL) {\
-        return false;\
-    }\
-    uint64_t hash = MELStringHash(key);\
-    unsigned int bucketIndex = hash % self.buckets.capacity;\
-    type##DictionaryBucket bucket = self.buckets.memory[bucketIndex];\
-    for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-        type##DictionaryEntry entry = bucket.entries.memory[entryIndex];\
-        if (entry.hash == hash && (entry.key == key || MELStringEquals(entry.key, key))) {\
-            *value = entry.value;\
-            return true;\
-        }\
-    }\
-    return false;\
+    return type##DictionaryGetIfPresentWithHash(&self, key, MELStringHash(key), value);\
+}\
+\
+type type##DictionaryGetWithAtom(type##Dictionary self, MELAtom _Nonnull key) {\
+    type value;\
+    return type##DictionaryGetIfPresentWithAtom(self, key, &value)\
+        ? value\
+        : nil;\
+}\
+\
+MELBoolean type##DictionaryGetIfPresentWithAtom(type##Dictionary self, MELAtom _Nonnull key, type * _Nonnull value) {\
+    return type##DictionaryGetIfPresentWithHash(&self, key, MELAtomGetHash(key), value);\
 }\
 \
 type type##DictionaryRemove(type##Dictionary * _Nonnull self, const char * _Nonnull key) {\
-    if (self->buckets.memory == 0 || self->buckets.memory == NULL) {\
+    const int removedIndex = type##DictionaryIndexOfKey(self, key, MELStringHash(key));\
+    if (removedIndex < 0) {\
         return nil;\
     }\
-    uint64_t hash = MELStringHash(key);\
-    unsigned int bucketIndex = hash % self->buckets.capacity;\
-    type##DictionaryBucket bucket = self->buckets.memory[bucketIndex];\
-    for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-        type##DictionaryEntry entry = bucket.entries.memory[entryIndex];\
-        if (entry.hash == hash && (entry.key == key || MELStringEquals(entry.key, key))) {\
-            bucket.entries.memory[entryIndex].key = NULL;\
-            type##DictionaryEntryListRemove(&self->buckets.memory[bucketIndex].entries, entryIndex);\
-            playdate->system->realloc(entry.key, 0);\
-            self->count--;\
-            return entry.value;\
-        }\
+    type##DictionaryEntry *entries = self->entries;\
+    const type value = entries[removedIndex].value;\
+    if (!self->borrowsKeys) {\
+        playdate->system->realloc(entries[removedIndex].key, 0);\
+    }\
+    /* Décalage arrière : les entrées suivantes se rapprochent de leur place, sans pierre tombale. */\
+    const unsigned int mask = self->capacity - 1;\
+    unsigned int index = (unsigned int) removedIndex;\
+    unsigned int next = (index + 1) & mask;\
+    while (entries[next].key != NULL && type##DictionaryProbeDistance(entries[next].hash, next, mask) > 0) {\
+        entries[index] = entries[next];\
+        index = next;\
+        next = (next + 1) & mask;\
     }\
-    return nil;\
+    entries[index] = (type##DictionaryEntry) {};\
+    self->count--;\
+    return value;\
 }\
 \
 type##DictionaryEntryList type##DictionaryEntries(type##Dictionary * _Nonnull self) {\
-    type##DictionaryEntryList entries = type##DictionaryEntryListMake();\
-\
-    type##DictionaryBucketList buckets = self->buckets;\
-    for (unsigned int bucketIndex = 0; bucketIndex < buckets.capacity; bucketIndex++) {\
-        type##DictionaryBucket bucket = buckets.memory[bucketIndex];\
-        for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-            type##DictionaryEntry entry = bucket.entries.memory[entryIndex];\
-            type##DictionaryEntryListPush(&entries, entry);\
+    type##DictionaryEntryList entries = type##DictionaryEntryListMakeWithInitialCapacity(self->count);\
+    for (unsigned int index = 0; index < self->capacity; index++) {\
+        if (self->entries[index].key != NULL) {\
+            type##DictionaryEntryListPush(&entries, self->entries[index]);\
         }\
     }\
     return entries;\
@@ -0,0 +1,19 @@
+//
+//  divider.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "divider.h"
+
+MELIntDivider MELIntDividerMake(int32_t divisor) {
+    if (divisor == 0) {
+        playdate->system->error("Unable to create a divider by 0");
+        divisor = 1;
+    }
+    return (MELIntDivider) {
+        .divider = libdivide_s32_gen(divisor),
+        .divisor = divisor,
+    };
+}
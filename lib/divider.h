@@ -0,0 +1,55 @@
+//
+//  divider.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef divider_h
+#define divider_h
+
+#include "melstd.h"
+
+#include "libdivide.h"
+
+/**
+ * Precomputed division by an integer known only at runtime.
+ *
+ * Create the divider once, when the divisor is loaded, and use it on hot paths.
+ * Dividing then costs a multiplication and a shift instead of a hardware division.
+ */
+typedef struct {
+    struct libdivide_s32_t divider;
+    /// Divisor of this divider. 0 when the divider has not been created yet.
+    int32_t divisor;
+} MELIntDivider;
+
+/**
+ * @brief Returns the quotient of the given numerator by the divisor of the given divider.
+ *
+ * Rounds toward zero, like the / operator.
+ *
+ * @param self Pointer to a divider.
+ * @param numerator The numerator.
+ */
+#define MELIntDividerDivide(self, numerator) libdivide_s32_do((numerator), &(self)->divider)
+
+/**
+ * @brief Returns the remainder of the division of the given numerator by the divisor of the given divider.
+ *
+ * Has the same sign as the numerator, like the % operator. numerator is evaluated twice.
+ *
+ * @param self Pointer to a divider.
+ * @param numerator The numerator.
+ */
+#define MELIntDividerModulo(self, numerator) ((numerator) - MELIntDividerDivide(self, numerator) * (self)->divisor)
+
+/**
+ * @brief Creates a divider for the given divisor.
+ *
+ * @param divisor The divisor. A divisor of 0 is an error and gives a divider by 1.
+ * @return A divider.
+ */
+MELIntDivider MELIntDividerMake(int32_t divisor);
+
+#endif /* divider_h */
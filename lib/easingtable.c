@@ -0,0 +1,52 @@
+//
+//  easingtable.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "easingtable.h"
+
+#define MELEasingTableDefineTabulated(function) \
+float function##Tabulated(float from, float to, float value) { \
+    static MELEasingTable table; \
+    if (table.samples == NULL) { \
+        table = MELEasingTableMake(function, MELEasingTableDefaultSampleCount); \
+    } \
+    return MELEasingTableGetValue(&table, from, to, value); \
+}
+
+MELEasingTable MELEasingTableMake(MELEasingFunction _Nonnull function, unsigned int sampleCount) {
+    float *samples = playdate->system->realloc(NULL, sizeof(float) * (sampleCount + 1));
+    for (unsigned int index = 0; index <= sampleCount; index++) {
+        samples[index] = function(0.0f, 1.0f, (float) index / sampleCount);
+    }
+    return (MELEasingTable) {
+        .samples = samples,
+        .sampleCount = sampleCount,
+    };
+}
+
+void MELEasingTableDeinit(MELEasingTable * _Nonnull self) {
+    playdate->system->realloc(self->samples, 0);
+    *self = (MELEasingTable) {};
+}
+
+float MELEasingTableGetValue(const MELEasingTable * _Nonnull self, float from, float to, float value) {
+    const unsigned int sampleCount = self->sampleCount;
+    if (from == to) {
+        // MELProgress diviserait par 0.
+        return self->samples[sampleCount];
+    }
+    const float units = MELProgress(from, to, value) * sampleCount;
+    const unsigned int index = units > 0.0f ? MELIntMin((int) units, sampleCount - 1) : 0;
+    const float sample = self->samples[index];
+    return sample + (self->samples[index + 1] - sample) * (units - index);
+}
+
+MELEasingTableDefineTabulated(MELEaseInOut)
+MELEasingTableDefineTabulated(MELEaseInBack)
+MELEasingTableDefineTabulated(MELEaseOutBack)
+MELEasingTableDefineTabulated(MELEaseOutElastic)
+MELEasingTableDefineTabulated(MELEaseOutBounce)
+MELEasingTableDefineTabulated(MELEaseOutExpo)
@@ -0,0 +1,65 @@
+//
+//  easingtable.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef easingtable_h
+#define easingtable_h
+
+#include "melstd.h"
+
+#include "melmath.h"
+
+#define MELEasingTableDefaultSampleCount 128
+
+/**
+ * Easing curve sampled at regular intervals between 0 and 1.
+ */
+typedef struct {
+    float * _Nullable samples;
+    /// Number of intervals. `samples` holds `sampleCount + 1` values.
+    unsigned int sampleCount;
+} MELEasingTable;
+
+/**
+ * @brief Samples the given easing function.
+ *
+ * More samples give a better precision at the cost of memory. 128 samples keep the error of
+ * MELEaseInOut below 5e-5 and the one of MELEaseOutElastic below 3e-3. Curves with sharp
+ * corners, like MELEaseOutBounce, are rounded over one sample around each corner.
+ *
+ * @param function The easing function to sample.
+ * @param sampleCount Number of intervals. Must be greater than 0.
+ * @return A table of the curve.
+ */
+MELEasingTable MELEasingTableMake(MELEasingFunction _Nonnull function, unsigned int sampleCount);
+
+void MELEasingTableDeinit(MELEasingTable * _Nonnull self);
+
+/**
+ * @brief Computes the tabulated interpolation between two values.
+ *
+ * @param self The table.
+ * @param from The starting value.
+ * @param to The ending value.
+ * @param value The interpolation factor.
+ * @return The interpolated value, with linear interpolation between samples. Returns the last sample when `from` equals `to`.
+ */
+float MELEasingTableGetValue(const MELEasingTable * _Nonnull self, float from, float to, float value);
+
+/*
+ * Tabulated versions of the easing functions of melmath.h. They can be given
+ * anywhere a MELEasingFunction is expected. Their table is built on first use with
+ * MELEasingTableDefaultSampleCount samples.
+ */
+
+float MELEaseInOutTabulated(float from, float to, float value);
+float MELEaseInBackTabulated(float from, float to, float value);
+float MELEaseOutBackTabulated(float from, float to, float value);
+float MELEaseOutElasticTabulated(float from, float to, float value);
+float MELEaseOutBounceTabulated(float from, float to, float value);
+float MELEaseOutExpoTabulated(float from, float to, float value);
+
+#endif /* easingtable_h */
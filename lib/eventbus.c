@@ -7,23 +7,28 @@
 
 #include "eventbus.h"
 
-static MELBoolean MELEventBusEntryEquals(MELEventBusEntry lhs, MELEventBusEntry rhs) {
-    return lhs.userdata == rhs.userdata;
-}
-
-MELListImplement(MELEventBusEntry);
-MELListImplementIndexOfWithEqualsFunction(MELEventBusEntry, MELEventBusEntryEquals);
+MELSmallListImplement(MELEventBusEntry);
 
 static MELEventBus kInstance = (MELEventBus) {};
 
+static int indexOfUserdata(MELEventBusEntrySmallList * _Nonnull listeners, void * _Nullable userdata) {
+    const MELEventBusEntry *entries = MELEventBusEntrySmallListMemory(listeners);
+    for (unsigned int index = 0; index < listeners->count; index++) {
+        if (entries[index].userdata == userdata) {
+            return index;
+        }
+    }
+    return -1;
+}
+
 void MELEventBusAddListener(Event event, void (* _Nullable listener)(void * _Nullable userdata, const int value), void * _Nullable userdata) {
 #if CHECK_IF_ALREADY_LISTENING
-    const int index = MELEventBusEntryListIndexOf(kInstance.listeners[event], (MELEventBusEntry) { .userdata = userdata });
+    const int index = indexOfUserdata(kInstance.listeners + event, userdata);
     if (index >= 0) {
         playdate->system->error("The given userdata is already listening event %d", event);
     }
 #endif
-    MELEventBusEntryListPush(kInstance.listeners + event, (MELEventBusEntry) {
+    MELEventBusEntrySmallListPush(kInstance.listeners + event, (MELEventBusEntry) {
         .listener = {
             .EventListenerInt = listener
         },
@@ -33,12 +38,12 @@ void MELEventBusAddListener(Event event, void (* _Nullable listener)(void * _Nul
 
 void MELEventBusAddListenerVoidPointer(Event event, void (* _Nullable listener)(void * _Nullable userdata, const void * _Nullable value), void * _Nullable userdata) {
 #if CHECK_IF_ALREADY_LISTENING
-    const int index = MELEventBusEntryListIndexOf(kInstance.listeners[event], (MELEventBusEntry) { .userdata = userdata });
+    const int index = indexOfUserdata(kInstance.listeners + event, userdata);
     if (index >= 0) {
         playdate->system->error("The given userdata is already listening event %d", event);
     }
 #endif
-    MELEventBusEntryListPush(kInstance.listeners + event, (MELEventBusEntry) {
+    MELEventBusEntrySmallListPush(kInstance.listeners + event, (MELEventBusEntry) {
         .listener = {
             .EventListenerVoidPointer = listener
         },
@@ -48,7 +53,11 @@ void MELEventBusAddListenerVoidPointer(Event event, void (* _Nullable listener)(
 
 void MELEventBusRemoveListener(Event event, void * _Nullable userdata) {
     // NOTE: Gérer le cas où une même classe écoute plusieurs fois le même événement ?
-    MELEventBusEntryListRemoveSwapEntry(kInstance.listeners + event, (MELEventBusEntry) { .userdata = userdata });
+    MELEventBusEntrySmallList *listeners = kInstance.listeners + event;
+    const int index = indexOfUserdata(listeners, userdata);
+    if (index >= 0) {
+        MELEventBusEntrySmallListRemoveSwap(listeners, index);
+    }
 }
 
 void MELEventBusRemoveListeners(void * _Nullable userdata) {
@@ -58,17 +67,17 @@ void MELEventBusRemoveListeners(void * _Nullable userdata) {
 }
 
 void MELEventBusFireEvent(Event event, int value) {
-    const MELEventBusEntryList entries = kInstance.listeners[event];
-    for (uint32_t index = 0; index < entries.count; index++) {
-        const MELEventBusEntry entry = entries.memory[index];
+    MELEventBusEntrySmallList *listeners = kInstance.listeners + event;
+    for (uint32_t index = 0; index < listeners->count; index++) {
+        const MELEventBusEntry entry = MELEventBusEntrySmallListGet(listeners, index);
         entry.listener.EventListenerInt(entry.userdata, value);
     }
 }
 
 void MELEventBusFireEventVoidPointer(Event event, const void * _Nullable value) {
-    const MELEventBusEntryList entries = kInstance.listeners[event];
-    for (uint32_t index = 0; index < entries.count; index++) {
-        const MELEventBusEntry entry = entries.memory[index];
+    MELEventBusEntrySmallList *listeners = kInstance.listeners + event;
+    for (uint32_t index = 0; index < listeners->count; index++) {
+        const MELEventBusEntry entry = MELEventBusEntrySmallListGet(listeners, index);
         entry.listener.EventListenerVoidPointer(entry.userdata, value);
     }
 }
@@ -23,11 +23,11 @@ typedef struct {
     void * _Nullable userdata;
 } MELEventBusEntry;
 
-MELListDefine(MELEventBusEntry);
-MELListDefineIndexOf(MELEventBusEntry);
+/// La plupart des événements n'ont que quelques écouteurs : ils sont stockés sans allocation.
+MELSmallListDefine(MELEventBusEntry, 4);
 
 typedef struct {
-    MELEventBusEntryList listeners[EventCount];
+    MELEventBusEntrySmallList listeners[EventCount];
 } MELEventBus;
 
 void MELEventBusAddListener(Event event, void (* _Nullable listener)(void * _Nullable userdata, const int value), void * _Nullable userdata);
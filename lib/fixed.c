@@ -0,0 +1,207 @@
+//
+//  fixed.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "fixed.h"
+
+#define SIN_TABLE_SIZE 256
+#define SIN_TABLE_MASK (SIN_TABLE_SIZE - 1)
+
+/// sin(2π × index / SIN_TABLE_SIZE) × 65536. The last entry repeats the first one so that interpolation never wraps.
+static const int32_t sinTable[SIN_TABLE_SIZE + 1] = {
+    0, 1608, 3216, 4821, 6424, 8022, 9616, 11204, 12785, 14359, 15924, 17479,
+    19024, 20557, 22078, 23586, 25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+    36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190, 46341, 47464, 48559, 49624,
+    50660, 51665, 52639, 53581, 54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+    60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944, 64277, 64571, 64827, 65043,
+    65220, 65358, 65457, 65516, 65536, 65516, 65457, 65358, 65220, 65043, 64827, 64571,
+    64277, 63944, 63572, 63162, 62714, 62228, 61705, 61145, 60547, 59914, 59244, 58538,
+    57798, 57022, 56212, 55368, 54491, 53581, 52639, 51665, 50660, 49624, 48559, 47464,
+    46341, 45190, 44011, 42806, 41576, 40320, 39040, 37736, 36410, 35062, 33692, 32303,
+    30893, 29466, 28020, 26558, 25080, 23586, 22078, 20557, 19024, 17479, 15924, 14359,
+    12785, 11204, 9616, 8022, 6424, 4821, 3216, 1608, 0, -1608, -3216, -4821,
+    -6424, -8022, -9616, -11204, -12785, -14359, -15924, -17479, -19024, -20557, -22078, -23586,
+    -25080, -26558, -28020, -29466, -30893, -32303, -33692, -35062, -36410, -37736, -39040, -40320,
+    -41576, -42806, -44011, -45190, -46341, -47464, -48559, -49624, -50660, -51665, -52639, -53581,
+    -54491, -55368, -56212, -57022, -57798, -58538, -59244, -59914, -60547, -61145, -61705, -62228,
+    -62714, -63162, -63572, -63944, -64277, -64571, -64827, -65043, -65220, -65358, -65457, -65516,
+    -65536, -65516, -65457, -65358, -65220, -65043, -64827, -64571, -64277, -63944, -63572, -63162,
+    -62714, -62228, -61705, -61145, -60547, -59914, -59244, -58538, -57798, -57022, -56212, -55368,
+    -54491, -53581, -52639, -51665, -50660, -49624, -48559, -47464, -46341, -45190, -44011, -42806,
+    -41576, -40320, -39040, -37736, -36410, -35062, -33692, -32303, -30893, -29466, -28020, -26558,
+    -25080, -23586, -22078, -20557, -19024, -17479, -15924, -14359, -12785, -11204, -9616, -8022,
+    -6424, -4821, -3216, -1608, 0,
+};
+
+MELFixed MELFixedMakeWithInt(int32_t value) {
+    return (MELFixed) ((uint32_t) value << MELFixedShift);
+}
+
+MELFixed MELFixedMakeWithFloat(float value) {
+    return (MELFixed) lroundf(value * MELFixedOne);
+}
+
+float MELFixedToFloat(MELFixed value) {
+    return value * (1.0f / MELFixedOne);
+}
+
+int32_t MELFixedFloor(MELFixed value) {
+    return value >> MELFixedShift;
+}
+
+int32_t MELFixedRound(MELFixed value) {
+    return (value + MELFixedHalf) >> MELFixedShift;
+}
+
+MELFixed MELFixedMultiply(MELFixed lhs, MELFixed rhs) {
+    return (MELFixed) (((int64_t) lhs * rhs) >> MELFixedShift);
+}
+
+MELFixed MELFixedDivide(MELFixed lhs, MELFixed rhs) {
+    return (MELFixed) (((int64_t) lhs << MELFixedShift) / rhs);
+}
+
+MELFixedDivider MELFixedDividerMake(MELFixed divisor) {
+    return (MELFixedDivider) {
+        .divider = libdivide_s64_gen(divisor),
+    };
+}
+
+MELFixed MELFixedDivideWithDivider(MELFixed lhs, const MELFixedDivider * _Nonnull divider) {
+    return (MELFixed) libdivide_s64_do((int64_t) lhs << MELFixedShift, &divider->divider);
+}
+
+MELFixed MELFixedSqrt(MELFixed value) {
+    if (value <= 0) {
+        return 0;
+    }
+    // Integer square root of value × 2^16, one bit at a time.
+    uint64_t remainder = (uint64_t) value << MELFixedShift;
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t) 1 << 62;
+    while (bit > remainder) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (remainder >= root + bit) {
+            remainder -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (MELFixed) root;
+}
+
+MELFixed MELFixedSin(MELFixed angle) {
+    // Angle in table units, with a 16 bit fractional part.
+    const int64_t units = ((int64_t) angle * SIN_TABLE_SIZE * MELFixedOne) / MELFixed2Pi;
+    const int32_t index = (int32_t) (units >> MELFixedShift) & SIN_TABLE_MASK;
+    const int32_t ratio = (int32_t) (units & (MELFixedOne - 1));
+    const int32_t from = sinTable[index];
+    return from + (MELFixed) (((int64_t) (sinTable[index + 1] - from) * ratio) >> MELFixedShift);
+}
+
+MELFixed MELFixedCos(MELFixed angle) {
+    return MELFixedSin(angle + MELFixedPi_2);
+}
+
+MELFixed MELFixedAtan2(MELFixed y, MELFixed x) {
+    if (x == 0 && y == 0) {
+        return 0;
+    }
+    const int64_t absX = x < 0 ? -(int64_t) x : x;
+    const int64_t absY = y < 0 ? -(int64_t) y : y;
+
+    // atan(z) ≈ π/4 × z + z × (1 - z) × (0.2447 + 0.0663 × z), for 0 <= z <= 1.
+    const MELBoolean swap = absY > absX;
+    const MELFixed z = (MELFixed) (((swap ? absX : absY) << MELFixedShift) / (swap ? absY : absX));
+    const MELFixed polynomial = MELFixedMultiply(z, MELFixedMultiply(MELFixedOne - z, 16037 + MELFixedMultiply(4345, z)));
+    MELFixed angle = MELFixedMultiply(MELFixedPi / 4, z) + polynomial;
+
+    if (swap) {
+        angle = MELFixedPi_2 - angle;
+    }
+    if (x < 0) {
+        angle = MELFixedPi - angle;
+    }
+    return y < 0 ? -angle : angle;
+}
+
+MELFixedPoint MELFixedPointMake(MELFixed x, MELFixed y) {
+    return (MELFixedPoint) {
+        .x = x,
+        .y = y,
+    };
+}
+
+MELFixedPoint MELFixedPointMakeWithPoint(MELPoint point) {
+    return (MELFixedPoint) {
+        .x = MELFixedMakeWithFloat(point.x),
+        .y = MELFixedMakeWithFloat(point.y),
+    };
+}
+
+MELPoint MELFixedPointToPoint(MELFixedPoint self) {
+    return (MELPoint) {
+        .x = MELFixedToFloat(self.x),
+        .y = MELFixedToFloat(self.y),
+    };
+}
+
+MELFixedPoint MELFixedPointAdd(MELFixedPoint lhs, MELFixedPoint rhs) {
+    return (MELFixedPoint) {
+        .x = lhs.x + rhs.x,
+        .y = lhs.y + rhs.y,
+    };
+}
+
+MELFixedPoint MELFixedPointSubstract(MELFixedPoint lhs, MELFixedPoint rhs) {
+    return (MELFixedPoint) {
+        .x = lhs.x - rhs.x,
+        .y = lhs.y - rhs.y,
+    };
+}
+
+MELFixedPoint MELFixedPointMultiply(MELFixedPoint self, MELFixed multiplier) {
+    return (MELFixedPoint) {
+        .x = MELFixedMultiply(self.x, multiplier),
+        .y = MELFixedMultiply(self.y, multiplier),
+    };
+}
+
+MELFixed MELFixedPointLength(MELFixedPoint self) {
+    const int64_t squaredLength = ((int64_t) self.x * self.x + (int64_t) self.y * self.y) >> MELFixedShift;
+    return MELFixedSqrt(squaredLength > INT32_MAX ? INT32_MAX : (MELFixed) squaredLength);
+}
+
+MELFixedRectangle MELFixedRectangleMakeWithRectangle(MELRectangle rectangle) {
+    return (MELFixedRectangle) {
+        .origin = MELFixedPointMakeWithPoint(rectangle.origin),
+        .width = MELFixedMakeWithFloat(rectangle.size.width),
+        .height = MELFixedMakeWithFloat(rectangle.size.height),
+    };
+}
+
+MELRectangle MELFixedRectangleToRectangle(MELFixedRectangle self) {
+    return (MELRectangle) {
+        .origin = MELFixedPointToPoint(self.origin),
+        .size = {
+            .width = MELFixedToFloat(self.width),
+            .height = MELFixedToFloat(self.height),
+        },
+    };
+}
+
+MELBoolean MELFixedRectangleIntersectsWithRectangle(MELFixedRectangle self, MELFixedRectangle other) {
+    const int64_t distanceX = (int64_t) self.origin.x - other.origin.x;
+    const int64_t distanceY = (int64_t) self.origin.y - other.origin.y;
+    const int64_t halfWidths = ((int64_t) self.width + other.width) >> 1;
+    const int64_t halfHeights = ((int64_t) self.height + other.height) >> 1;
+    return (distanceX < 0 ? -distanceX : distanceX) < halfWidths
+        && (distanceY < 0 ? -distanceY : distanceY) < halfHeights;
+}
@@ -0,0 +1,233 @@
+//
+//  fixed.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef fixed_h
+#define fixed_h
+
+#include "melstd.h"
+
+#include "point.h"
+#include "rectangle.h"
+#include "libdivide.h"
+
+/**
+ * Signed 16.16 fixed-point number.
+ */
+typedef int32_t MELFixed;
+
+#define MELFixedShift 16
+#define MELFixedOne ((MELFixed) 1 << MELFixedShift)
+#define MELFixedHalf (MELFixedOne >> 1)
+#define MELFixedPi ((MELFixed) 205887)   // π × 65536
+#define MELFixedPi_2 ((MELFixed) 102944) // π / 2 × 65536
+#define MELFixed2Pi ((MELFixed) 411775)  // 2π × 65536
+
+/**
+ * Precomputed divider to divide many fixed-point values by the same fixed-point value.
+ */
+typedef struct {
+    struct libdivide_s64_t divider;
+} MELFixedDivider;
+
+/**
+ * Fixed-point coordinates of a point in a 2D plane.
+ */
+typedef struct {
+    MELFixed x;
+    MELFixed y;
+} MELFixedPoint;
+
+/**
+ * Fixed-point rectangle. Like MELRectangle in the sprites, the origin is the center.
+ */
+typedef struct {
+    MELFixedPoint origin;
+    MELFixed width;
+    MELFixed height;
+} MELFixedRectangle;
+
+/**
+ * @brief Returns the fixed-point value of the given integer.
+ *
+ * @param value Integer between -32768 and 32767.
+ * @return A fixed-point value.
+ */
+MELFixed MELFixedMakeWithInt(int32_t value);
+
+/**
+ * @brief Returns the fixed-point value closest to the given float.
+ *
+ * @param value Float between -32768 and 32767.
+ * @return A fixed-point value.
+ */
+MELFixed MELFixedMakeWithFloat(float value);
+
+/**
+ * @brief Converts the given fixed-point value to float.
+ *
+ * @param value The fixed-point value.
+ * @return value as a float.
+ */
+float MELFixedToFloat(MELFixed value);
+
+/**
+ * @brief Returns the largest integer less than or equal to the given value.
+ *
+ * @param value The fixed-point value.
+ * @return The floor of value.
+ */
+int32_t MELFixedFloor(MELFixed value);
+
+/**
+ * @brief Returns the integer closest to the given value.
+ *
+ * @param value The fixed-point value.
+ * @return value rounded to the nearest integer.
+ */
+int32_t MELFixedRound(MELFixed value);
+
+/**
+ * @brief Multiplies two fixed-point values.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return lhs × rhs.
+ */
+MELFixed MELFixedMultiply(MELFixed lhs, MELFixed rhs);
+
+/**
+ * @brief Divides two fixed-point values.
+ *
+ * @param lhs The dividend.
+ * @param rhs The divisor. Must not be zero.
+ * @return lhs / rhs.
+ */
+MELFixed MELFixedDivide(MELFixed lhs, MELFixed rhs);
+
+/**
+ * @brief Creates a divider for the given value.
+ *
+ * Dividing by a divider replaces the hardware division by a multiplication and a shift.
+ *
+ * @param divisor The divisor. Must not be zero.
+ * @return A divider.
+ */
+MELFixedDivider MELFixedDividerMake(MELFixed divisor);
+
+/**
+ * @brief Divides a fixed-point value with a precomputed divider.
+ *
+ * @param lhs The dividend.
+ * @param divider The divider.
+ * @return lhs / divisor.
+ */
+MELFixed MELFixedDivideWithDivider(MELFixed lhs, const MELFixedDivider * _Nonnull divider);
+
+/**
+ * @brief Returns the square root of the given value.
+ *
+ * @param value A positive fixed-point value. Negative values return 0.
+ * @return The square root of value.
+ */
+MELFixed MELFixedSqrt(MELFixed value);
+
+/**
+ * @brief Returns the sine of the given angle.
+ *
+ * @param angle Angle in radians.
+ * @return The sine of angle, with an error below 1e-4.
+ */
+MELFixed MELFixedSin(MELFixed angle);
+
+/**
+ * @brief Returns the cosine of the given angle.
+ *
+ * @param angle Angle in radians.
+ * @return The cosine of angle, with an error below 1e-4.
+ */
+MELFixed MELFixedCos(MELFixed angle);
+
+/**
+ * @brief Returns an approximation of the angle of the vector (x, y).
+ *
+ * @param y Vertical component.
+ * @param x Horizontal component.
+ * @return The angle in radians, between -π and π, with an error below 0.002 radian.
+ */
+MELFixed MELFixedAtan2(MELFixed y, MELFixed x);
+
+/**
+ * @brief Returns a point with the given coordinates.
+ *
+ * @param x Horizontal coordinate.
+ * @param y Vertical coordinate.
+ * @return A point.
+ */
+MELFixedPoint MELFixedPointMake(MELFixed x, MELFixed y);
+
+/**
+ * @brief Converts the given point to fixed-point.
+ *
+ * @param point A point.
+ * @return A fixed-point point.
+ */
+MELFixedPoint MELFixedPointMakeWithPoint(MELPoint point);
+
+/**
+ * @brief Converts the given fixed-point point to float.
+ *
+ * @param self A fixed-point point.
+ * @return A point.
+ */
+MELPoint MELFixedPointToPoint(MELFixedPoint self);
+
+MELFixedPoint MELFixedPointAdd(MELFixedPoint lhs, MELFixedPoint rhs);
+MELFixedPoint MELFixedPointSubstract(MELFixedPoint lhs, MELFixedPoint rhs);
+
+/**
+ * @brief Multiplies both coordinates of the given point by the given value.
+ *
+ * @param self A point.
+ * @param multiplier The multiplier.
+ * @return The scaled point.
+ */
+MELFixedPoint MELFixedPointMultiply(MELFixedPoint self, MELFixed multiplier);
+
+/**
+ * @brief Returns the distance between the given point and the origin.
+ *
+ * @param self A point.
+ * @return The length of self.
+ */
+MELFixed MELFixedPointLength(MELFixedPoint self);
+
+/**
+ * @brief Converts the given rectangle to fixed-point.
+ *
+ * @param rectangle A rectangle whose origin is the center.
+ * @return A fixed-point rectangle.
+ */
+MELFixedRectangle MELFixedRectangleMakeWithRectangle(MELRectangle rectangle);
+
+/**
+ * @brief Converts the given fixed-point rectangle to float.
+ *
+ * @param self A fixed-point rectangle.
+ * @return A rectangle whose origin is the center.
+ */
+MELRectangle MELFixedRectangleToRectangle(MELFixedRectangle self);
+
+/**
+ * @brief Checks if two rectangles overlap.
+ *
+ * @param self A rectangle.
+ * @param other Another rectangle.
+ * @return true if both rectangles overlap.
+ */
+MELBoolean MELFixedRectangleIntersectsWithRectangle(MELFixedRectangle self, MELFixedRectangle other);
+
+#endif /* fixed_h */
@@ -3,65 +3,168 @@
 #include "melmath.h"
 
 MELListImplement(MELPointer);
+MELListImplement(MELRectangle);
 MELKeyValueTableImplement(MELPointer, MELBoolean);
 
 static int bucketIndexForPoint(MELPoint point);
-static void grow(MELGeoMapBucket * _Nonnull self, unsigned int size);
-static void ensureCapacity(MELGeoMapBucket * _Nonnull self, unsigned int required);
+static MELIntRectangle cellsForRectangle(MELRectangle rectangle);
+static MELBoolean cellsContainsCell(MELIntRectangle cells, int x, int y);
+static uint32_t nextGeneration(void);
+static MELBoolean growBucket(MELGeoMap * _Nonnull self, int bucketIndex, unsigned int required);
+static void ensureCellCapacity(MELGeoMap * _Nonnull self, uint32_t required);
 static void push(MELGeoMap * _Nonnull self, int bucketIndex, LCDSpriteRef element);
+static void removeFromBucket(MELGeoMap * _Nonnull self, int bucketIndex, LCDSpriteRef element);
+static void pushInCells(MELGeoMap * _Nonnull self, MELIntRectangle cells, MELIntRectangle exclusions, LCDSpriteRef element);
+static void removeFromCells(MELGeoMap * _Nonnull self, MELIntRectangle cells, MELIntRectangle exclusions, LCDSpriteRef element);
 
+static void rebuild(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites, const MELRectangle * _Nullable frames);
 static void findNext(MELGeoMapIterator * _Nonnull self);
 
+/// Dernière génération attribuée. Partagée par toutes les cartes pour qu'un emplacement mémorisé par un sprite ne soit valide que dans la carte qui l'a créé.
+static uint32_t lastGeneration;
+
 MELGeoMap * _Nonnull MELGeoMapAlloc(void) {
     MELGeoMap *self = playdate->system->realloc(NULL, sizeof(MELGeoMap));
-    *self = (MELGeoMap) {};
+    *self = (MELGeoMap) {
+        .generation = nextGeneration(),
+    };
     return self;
 }
 
+void MELGeoMapDeinit(MELGeoMap * _Nonnull self) {
+    playdate->system->realloc(self->cells, 0);
+    *self = (MELGeoMap) {
+        .generation = nextGeneration(),
+    };
+}
+
 void MELGeoMapClear(MELGeoMap * _Nonnull self) {
     memset(self->counts, 0, sizeof(uint16_t) * kMELGeoMapBucketCount);
+    // Les cellules sont vides : les trous laissés par growBucket sont supprimés sans rien déplacer.
+    uint32_t total = 0;
+    for (int bucketIndex = 0; bucketIndex < kMELGeoMapBucketCount; bucketIndex++) {
+        self->offsets[bucketIndex] = total;
+        total += self->capacities[bucketIndex];
+    }
+    self->cellCount = total;
+    self->generation = nextGeneration();
 }
 
 void MELGeoMapPutSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite) {
     MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
-    MELRectangle frame = melSprite->frame;
-    MELIntPoint topLeft = (MELIntPoint) {
-        .x = MELIntMax((frame.origin.x - frame.size.width / 2) / kMELGeoMapCellWidth, 0),
-        .y = MELIntMax((frame.origin.y - frame.size.height / 2) / kMELGeoMapCellHeight, 0),
+    const MELIntRectangle cells = cellsForRectangle(melSprite->frame);
+    pushInCells(self, cells, (MELIntRectangle) {}, sprite);
+    melSprite->geoMapLocation = (MELGeoMapLocation) {
+        .cells = cells,
+        .generation = self->generation,
     };
-    MELIntPoint bottomRight = (MELIntPoint) {
-        .x = MELIntMin((frame.origin.x + frame.size.width / 2) / kMELGeoMapCellWidth, kMELGeoMapCellsInARow - 1),
-        .y = MELIntMin((frame.origin.y + frame.size.height / 2) / kMELGeoMapCellHeight, kMELGeoMapCellsInAColumn - 1),
+}
+
+void MELGeoMapMoveSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    const MELIntRectangle cells = cellsForRectangle(melSprite->frame);
+    MELGeoMapLocation *location = &melSprite->geoMapLocation;
+    if (location->generation != self->generation) {
+        pushInCells(self, cells, (MELIntRectangle) {}, sprite);
+    } else if (memcmp(&location->cells, &cells, sizeof(MELIntRectangle))) {
+        // Seules les cellules quittées et les nouvelles cellules sont modifiées.
+        removeFromCells(self, location->cells, cells, sprite);
+        pushInCells(self, cells, location->cells, sprite);
+    } else {
+        return;
+    }
+    *location = (MELGeoMapLocation) {
+        .cells = cells,
+        .generation = self->generation,
     };
+}
 
-    for (int y = topLeft.y; y <= bottomRight.y; y++) {
-        for (int x = topLeft.x; x <= bottomRight.x; x++) {
-            push(self, y * kMELGeoMapCellsInARow + x, sprite);
+void MELGeoMapRemoveSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    MELGeoMapLocation *location = &melSprite->geoMapLocation;
+    if (location->generation != self->generation) {
+        return;
+    }
+    removeFromCells(self, location->cells, (MELIntRectangle) {}, sprite);
+    *location = (MELGeoMapLocation) {};
+}
+
+void MELGeoMapRebuild(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites) {
+    rebuild(self, sprites, NULL);
+}
+
+void MELGeoMapRebuildWithFrames(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites, MELRectangleList frames) {
+    if (frames.count < sprites.count) {
+        playdate->system->error("MELGeoMapRebuildWithFrames: %d frames given for %d sprites", frames.count, sprites.count);
+        return;
+    }
+    rebuild(self, sprites, frames.memory);
+}
+
+/**
+ * Range les sprites donnés avec un tri par dénombrement.
+ *
+ * @param frames Rectangle de chaque sprite ou NULL pour utiliser leur `frame`.
+ */
+static void rebuild(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites, const MELRectangle * _Nullable frames) {
+    MELGeoMapClear(self);
+    const uint32_t generation = self->generation;
+    uint16_t *counts = self->counts;
+
+    // Comptage du nombre de sprites par cellule.
+    for (unsigned int index = 0; index < sprites.count; index++) {
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprites.memory[index]);
+        const MELIntRectangle cells = cellsForRectangle(frames != NULL ? frames[index] : melSprite->frame);
+        melSprite->geoMapLocation = (MELGeoMapLocation) {
+            .cells = cells,
+            .generation = generation,
+        };
+        for (int y = cells.origin.y; y < cells.origin.y + cells.size.height; y++) {
+            for (int x = cells.origin.x; x < cells.origin.x + cells.size.width; x++) {
+                counts[y * kMELGeoMapCellsInARow + x]++;
+            }
+        }
+    }
+
+    // Calcul de la position de chaque cellule. Un peu de marge est laissée pour les appels à MELGeoMapMoveSprite.
+    uint32_t total = 0;
+    for (int bucketIndex = 0; bucketIndex < kMELGeoMapBucketCount; bucketIndex++) {
+        const unsigned int count = counts[bucketIndex];
+        const uint16_t capacity = MELIntMin(count + count / 2 + 1, UINT16_MAX);
+        self->offsets[bucketIndex] = total;
+        self->capacities[bucketIndex] = capacity;
+        total += capacity;
+    }
+    ensureCellCapacity(self, total);
+    self->cellCount = total;
+    memset(counts, 0, sizeof(uint16_t) * kMELGeoMapBucketCount);
+
+    // Rangement des sprites.
+    LCDSpriteRef *allCells = self->cells;
+    for (unsigned int index = 0; index < sprites.count; index++) {
+        LCDSprite *sprite = sprites.memory[index];
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+        const MELIntRectangle cells = melSprite->geoMapLocation.cells;
+        for (int y = cells.origin.y; y < cells.origin.y + cells.size.height; y++) {
+            for (int x = cells.origin.x; x < cells.origin.x + cells.size.width; x++) {
+                const int bucketIndex = y * kMELGeoMapCellsInARow + x;
+                allCells[self->offsets[bucketIndex] + counts[bucketIndex]++] = sprite;
+            }
         }
     }
 }
 
 LCDSpriteRefList MELGeoMapSpriteListAtPoint(MELGeoMap * _Nonnull self, MELPoint point) {
     const int bucketIndex = bucketIndexForPoint(point);
-    MELGeoMapBucket bucket = self->buckets[bucketIndex];
     return (LCDSpriteRefList) {
         .count = self->counts[bucketIndex],
-        .capacity = bucket.capacity,
-        .memory = bucket.memory,
+        .capacity = self->capacities[bucketIndex],
+        .memory = self->cells != NULL ? self->cells + self->offsets[bucketIndex] : NULL,
     };
 }
 
 void MELGeoMapSpritesInRectangleWithIterator(MELGeoMap * _Nonnull self, MELRectangle rectangle, MELGeoMapIterator * _Nonnull iterator, MELPointerList exclusions) {
-    MELIntPoint topLeft = (MELIntPoint) {
-        .x = MELIntMax((rectangle.origin.x - rectangle.size.width / 2) / kMELGeoMapCellWidth, 0),
-        .y = MELIntMax((rectangle.origin.y - rectangle.size.height / 2) / kMELGeoMapCellHeight, 0),
-    };
-    MELIntPoint bottomRight = (MELIntPoint) {
-        .x = MELIntMin((rectangle.origin.x + rectangle.size.width / 2) / kMELGeoMapCellWidth, kMELGeoMapCellsInARow - 1),
-        .y = MELIntMin((rectangle.origin.y + rectangle.size.height / 2) / kMELGeoMapCellHeight, kMELGeoMapCellsInAColumn - 1),
-    };
-    const int width = bottomRight.x - topLeft.x;
-    const int height = bottomRight.y - topLeft.y;
+    const MELIntRectangle cells = cellsForRectangle(rectangle);
 
     MELPointerMELBooleanTable set = iterator->set;
     MELPointerMELBooleanTableClear(&set);
@@ -72,15 +175,11 @@ void MELGeoMapSpritesInRectangleWithIterator(MELGeoMap * _Nonnull self, MELRecta
 
     *iterator = (MELGeoMapIterator) {
         .geoMap = self,
-        .rectangle = (MELIntRectangle) {
-            .origin = topLeft,
-            .size = {
-                .width = width,
-                .height = height
-            }
-        },
-        .count = width * height,
+        .rectangle = cells,
+        .count = cells.size.width * cells.size.height,
         .index = 0,
+        .x = cells.origin.x,
+        .y = cells.origin.y,
         .cellIndex = 0,
         .set = set,
     };
@@ -109,37 +208,42 @@ MELBoolean MELGeoMapIteratorHasNext(MELGeoMapIterator * _Nonnull self) {
 }
 
 LCDSprite * _Nonnull MELGeoMapIteratorNext(MELGeoMapIterator * _Nonnull self) {
-    const int index = self->index;
-    const MELIntRectangle rectangle = self->rectangle;
-    const int x = index % rectangle.size.width + rectangle.origin.x;
-    const int y = index / rectangle.size.width + rectangle.origin.y;
-    const int bucketIndex = y * kMELGeoMapCellsInARow + x;
-    LCDSprite *sprite = self->geoMap->buckets[bucketIndex].memory[self->cellIndex++];
+    const int bucketIndex = self->y * kMELGeoMapCellsInARow + self->x;
+    const MELGeoMap *geoMap = self->geoMap;
+    LCDSprite *sprite = geoMap->cells[geoMap->offsets[bucketIndex] + self->cellIndex++];
     findNext(self);
     return sprite;
 }
 
 static void findNext(MELGeoMapIterator * _Nonnull self) {
     const MELIntRectangle rectangle = self->rectangle;
+    const int right = rectangle.origin.x + rectangle.size.width;
     const int count = self->count;
-    const MELGeoMap geoMap = *self->geoMap;
+    const MELGeoMap *geoMap = self->geoMap;
     int cellIndex = self->cellIndex;
+    int x = self->x;
+    int y = self->y;
     for (int index = self->index; index < count; index++) {
-        const int x = index % rectangle.size.width + rectangle.origin.x;
-        const int y = index / rectangle.size.width + rectangle.origin.y;
         const int bucketIndex = y * kMELGeoMapCellsInARow + x;
-        const int cellCount = geoMap.counts[bucketIndex];
-        MELGeoMapBucket bucket = geoMap.buckets[bucketIndex];
+        const int cellCount = geoMap->counts[bucketIndex];
+        LCDSpriteRef *bucket = geoMap->cells + geoMap->offsets[bucketIndex];
         for (int i = cellIndex; i < cellCount; i++) {
             MELBoolean wasPresent = false;
-            MELPointerMELBooleanTablePutAndGetOldValue(&self->set, (MELPointer) bucket.memory[i], true, &wasPresent);
+            MELPointerMELBooleanTablePutAndGetOldValue(&self->set, (MELPointer) bucket[i], true, &wasPresent);
             if (!wasPresent) {
                 self->index = index;
+                self->x = x;
+                self->y = y;
                 self->cellIndex = i;
                 return;
             }
         }
         cellIndex = 0;
+        // Cellule suivante, de gauche à droite puis de haut en bas.
+        if (++x == right) {
+            x = rectangle.origin.x;
+            y++;
+        }
     }
     // Pas de sprite suivant.
     self->index = self->count;
@@ -150,22 +254,120 @@ static int bucketIndexForPoint(MELPoint point) {
     return kMELGeoMapCellsInARow * point.y / kMELGeoMapCellHeight + point.x / kMELGeoMapCellWidth;
 }
 
-static void grow(MELGeoMapBucket * _Nonnull self, unsigned int size) {
-    self->memory = playdate->system->realloc(self->memory, size * sizeof(LCDSpriteRef));
-    self->capacity = size;
+/**
+ * Retourne les cellules touchées par le rectangle donné.
+ * La taille est nulle si le rectangle est entièrement en dehors de la carte.
+ *
+ * @param rectangle Rectangle dont l'origine est le centre.
+ * @return Les cellules touchées, bornes incluses.
+ */
+static MELIntRectangle cellsForRectangle(MELRectangle rectangle) {
+    // Division entière par une constante : le compilateur la remplace par une multiplication.
+    MELIntPoint topLeft = (MELIntPoint) {
+        .x = MELIntMax((int) (rectangle.origin.x - rectangle.size.width / 2) / kMELGeoMapCellWidth, 0),
+        .y = MELIntMax((int) (rectangle.origin.y - rectangle.size.height / 2) / kMELGeoMapCellHeight, 0),
+    };
+    MELIntPoint bottomRight = (MELIntPoint) {
+        .x = MELIntMin((int) (rectangle.origin.x + rectangle.size.width / 2) / kMELGeoMapCellWidth, kMELGeoMapCellsInARow - 1),
+        .y = MELIntMin((int) (rectangle.origin.y + rectangle.size.height / 2) / kMELGeoMapCellHeight, kMELGeoMapCellsInAColumn - 1),
+    };
+    return (MELIntRectangle) {
+        .origin = topLeft,
+        .size = {
+            .width = MELIntMax(bottomRight.x - topLeft.x + 1, 0),
+            .height = MELIntMax(bottomRight.y - topLeft.y + 1, 0),
+        },
+    };
+}
+
+static MELBoolean cellsContainsCell(MELIntRectangle cells, int x, int y) {
+    return x >= cells.origin.x && x < cells.origin.x + cells.size.width
+        && y >= cells.origin.y && y < cells.origin.y + cells.size.height;
+}
+
+static uint32_t nextGeneration(void) {
+    if (++lastGeneration == 0) {
+        // 0 est réservé aux sprites qui n'ont jamais été ajoutés.
+        lastGeneration = 1;
+    }
+    return lastGeneration;
+}
+
+/**
+ * Agrandit la cellule donnée.
+ *
+ * La cellule est agrandie sur place si elle est la dernière du tableau. Sinon, elle est déplacée à la fin du tableau
+ * plutôt que de décaler toutes les cellules suivantes. La place libérée est récupérée par `MELGeoMapClear`
+ * et `MELGeoMapRebuild`.
+ *
+ * @return false si la cellule ne peut pas contenir `required` sprites.
+ */
+static MELBoolean growBucket(MELGeoMap * _Nonnull self, int bucketIndex, unsigned int required) {
+    if (required > UINT16_MAX) {
+        playdate->system->error("MELGeoMap: too many sprites in cell %d (%u, maximum is %d)", bucketIndex, required, UINT16_MAX);
+        return false;
+    }
+    const uint16_t oldCapacity = self->capacities[bucketIndex];
+    const uint16_t capacity = MELIntMin(MELIntMax(MELListNextCapacity(oldCapacity), required), UINT16_MAX);
+    uint32_t offset = self->offsets[bucketIndex];
+    if (offset + oldCapacity != self->cellCount) {
+        const uint32_t newOffset = self->cellCount;
+        ensureCellCapacity(self, newOffset + capacity);
+        memcpy(self->cells + newOffset, self->cells + offset, self->counts[bucketIndex] * sizeof(LCDSpriteRef));
+        self->offsets[bucketIndex] = offset = newOffset;
+    } else {
+        ensureCellCapacity(self, offset + capacity);
+    }
+    self->capacities[bucketIndex] = capacity;
+    self->cellCount = offset + capacity;
+    return true;
 }
 
-static void ensureCapacity(MELGeoMapBucket * _Nonnull self, unsigned int required) {
-    if (self->capacity < required) {
-        const unsigned int newCapacity = self->capacity + (self->capacity * 2) + 1;
-        grow(self, newCapacity > required ? newCapacity : required);
+static void ensureCellCapacity(MELGeoMap * _Nonnull self, uint32_t required) {
+    if (self->cellCapacity < required) {
+        const uint32_t newCapacity = MELIntMax(MELListNextCapacity(self->cellCapacity), required);
+        self->cells = playdate->system->realloc(self->cells, newCapacity * sizeof(LCDSpriteRef));
+        self->cellCapacity = newCapacity;
     }
 }
 
 static void push(MELGeoMap * _Nonnull self, int bucketIndex, LCDSpriteRef element) {
-    MELGeoMapBucket *bucket = self->buckets + bucketIndex;
     const int count = self->counts[bucketIndex];
-    ensureCapacity(bucket, count + 1);
-    bucket->memory[count] = element;
+    if (count + 1 > self->capacities[bucketIndex] && !growBucket(self, bucketIndex, count + 1)) {
+        return;
+    }
+    self->cells[self->offsets[bucketIndex] + count] = element;
     self->counts[bucketIndex] = count + 1;
 }
+
+static void removeFromBucket(MELGeoMap * _Nonnull self, int bucketIndex, LCDSpriteRef element) {
+    LCDSpriteRef *bucket = self->cells + self->offsets[bucketIndex];
+    const int count = self->counts[bucketIndex];
+    for (int index = 0; index < count; index++) {
+        if (bucket[index] == element) {
+            bucket[index] = bucket[count - 1];
+            self->counts[bucketIndex] = count - 1;
+            return;
+        }
+    }
+}
+
+static void pushInCells(MELGeoMap * _Nonnull self, MELIntRectangle cells, MELIntRectangle exclusions, LCDSpriteRef element) {
+    for (int y = cells.origin.y; y < cells.origin.y + cells.size.height; y++) {
+        for (int x = cells.origin.x; x < cells.origin.x + cells.size.width; x++) {
+            if (!cellsContainsCell(exclusions, x, y)) {
+                push(self, y * kMELGeoMapCellsInARow + x, element);
+            }
+        }
+    }
+}
+
+static void removeFromCells(MELGeoMap * _Nonnull self, MELIntRectangle cells, MELIntRectangle exclusions, LCDSpriteRef element) {
+    for (int y = cells.origin.y; y < cells.origin.y + cells.size.height; y++) {
+        for (int x = cells.origin.x; x < cells.origin.x + cells.size.width; x++) {
+            if (!cellsContainsCell(exclusions, x, y)) {
+                removeFromBucket(self, y * kMELGeoMapCellsInARow + x, element);
+            }
+        }
+    }
+}
@@ -24,16 +24,22 @@
 #define kMELGeoMapBucketCount (kMELGeoMapCellsInARow * kMELGeoMapCellsInAColumn)
 
 MELListDefine(MELPointer);
+MELListDefine(MELRectangle);
 MELKeyValueTableDefine(MELPointer, MELBoolean);
 
-typedef struct {
-    uint32_t capacity;
-    LCDSpriteRef * _Nullable memory;
-} MELGeoMapBucket;
-
 typedef struct geomap {
     uint16_t counts[kMELGeoMapBucketCount];
-    MELGeoMapBucket buckets[kMELGeoMapBucketCount];
+    uint16_t capacities[kMELGeoMapBucketCount];
+    /// Index de la première case de chaque cellule dans `cells`.
+    uint32_t offsets[kMELGeoMapBucketCount];
+    /// Contenu de toutes les cellules, rangées les unes à la suite des autres.
+    LCDSpriteRef * _Nullable cells;
+    /// Nombre de cases utilisées par les cellules, trous compris.
+    uint32_t cellCount;
+    uint32_t cellCapacity;
+    /// Changée par `MELGeoMapClear` et `MELGeoMapRebuild` pour invalider les emplacements mémorisés par les sprites.
+    /// Unique parmi toutes les cartes.
+    uint32_t generation;
 } MELGeoMap;
 
 typedef struct geomapiterator {
@@ -41,6 +47,9 @@ typedef struct geomapiterator {
     MELIntRectangle rectangle;
     int count;
     int index;
+    /// Colonne et ligne de la cellule d'index `index`.
+    int x;
+    int y;
     int cellIndex;
     MELPointerMELBooleanTable set;
     MELPointerMELBooleanTable exclusions;
@@ -50,6 +59,50 @@ MELGeoMap * _Nonnull MELGeoMapAlloc(void);
 void MELGeoMapDeinit(MELGeoMap * _Nonnull self);
 void MELGeoMapClear(MELGeoMap * _Nonnull self);
 void MELGeoMapPutSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Ajoute le sprite donné ou met à jour sa position dans la carte.
+ *
+ * Les cellules occupées par le sprite sont mémorisées dans `geoMapLocation`. Les cellules ne sont modifiées que si
+ * le sprite a changé de cellule depuis le dernier appel : un sprite immobile ne coûte qu'une comparaison.
+ *
+ * @note Un sprite ajouté avec cette fonction doit être retiré avec `MELGeoMapRemoveSprite` avant d'être désalloué.
+ * Un sprite n'a qu'un seul emplacement : il ne peut être déplacé avec cette fonction que dans une seule carte à la fois.
+ *
+ * @param self Carte à modifier.
+ * @param sprite Sprite à ajouter ou à déplacer.
+ */
+void MELGeoMapMoveSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Retire le sprite donné de toutes les cellules qu'il occupe.
+ * Ne fait rien si le sprite n'est pas dans la carte.
+ *
+ * @param self Carte à modifier.
+ * @param sprite Sprite à retirer.
+ */
+void MELGeoMapRemoveSprite(MELGeoMap * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Vide la carte et y range tous les sprites donnés en une seule passe.
+ *
+ * Le nombre de sprites par cellule est compté avant de ranger les sprites (tri par dénombrement) :
+ * chaque cellule est dimensionnée une seule fois et toutes les cellules partagent le même tableau.
+ *
+ * @param self Carte à reconstruire.
+ * @param sprites Sprites à ranger dans la carte.
+ */
+void MELGeoMapRebuild(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites);
+
+/**
+ * Vide la carte et y range tous les sprites donnés en utilisant les rectangles donnés à la place de leur `frame`.
+ *
+ * @param self Carte à reconstruire.
+ * @param sprites Sprites à ranger dans la carte.
+ * @param frames Rectangle de chaque sprite, dans le même ordre que `sprites`.
+ */
+void MELGeoMapRebuildWithFrames(MELGeoMap * _Nonnull self, LCDSpriteRefList sprites, MELRectangleList frames);
+
 LCDSpriteRefList MELGeoMapSpriteListAtPoint(MELGeoMap * _Nonnull self, MELPoint point);
 MELGeoMapIterator * _Nonnull MELGeoMapSpriteIteratorInRectangle(MELGeoMap * _Nonnull self, MELRectangle rectangle);
 void MELGeoMapSpritesInRectangleWithIterator(MELGeoMap * _Nonnull self, MELRectangle rectangle, MELGeoMapIterator * _Nonnull iterator, MELPointerList exclusions);
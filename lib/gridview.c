@@ -8,6 +8,7 @@
 #include "gridview.h"
 
 #include "melmath.h"
+#include "easingtable.h"
 #include "camera.h"
 
 static void destroy(LCDSprite * _Nonnull sprite);
@@ -370,7 +371,7 @@ static void updateScrolling(LCDSprite * _Nonnull sprite) {
     if (self->time < duration) {
         float newTime;
         newTime = self->time += DELTA;
-        const float progress = MELEaseInOut(0.0f, duration, newTime);
+        const float progress = MELEaseInOutTabulated(0.0f, duration, newTime);
 
         self->camera = MELPointAdd(self->cameraFrom, MELPointMultiplyByValue(self->cameraDistance, progress));
         draw(self, playdate->sprite->getImage(sprite));
@@ -404,7 +405,7 @@ static void updateScrollRepeat(LCDSprite * _Nonnull sprite) {
     if (self->time < duration) {
         float newTime;
         newTime = self->time += DELTA;
-        const float progress = MELEaseInOut(0.0f, duration, newTime);
+        const float progress = MELEaseInOutTabulated(0.0f, duration, newTime);
 
         self->camera = MELPointAdd(self->cameraFrom, MELPointMultiplyByValue(self->cameraDistance, progress));
         draw(self, playdate->sprite->getImage(sprite));
@@ -15,6 +15,39 @@
 #include "statichitbox.h"
 #include "spritehitbox.h"
 #include "simplespritehitbox.h"
+#include "maskhitbox.h"
+#include "orientedhitbox.h"
+#include "capsulehitbox.h"
+#include "sprite.h"
+
+uint32_t MELHitboxFrame = 1;
+
+/**
+ * Appelle directement les implémentations connues de `getFrame` pour éviter un appel indirect.
+ */
+static inline MELRectangle getFrame(MELHitbox * _Nonnull self) {
+    const MELHitboxClass *class = self->class;
+    if (class == &MELSimpleSpriteHitboxClass) {
+        return ((MELSimpleSpriteHitbox *)self)->sprite->frame;
+    } else if (class == &MELMaskHitboxClass) {
+        return ((MELMaskHitbox *)self)->sprite->frame;
+    } else if (class == &MELSpriteHitboxClass) {
+        const MELSprite *sprite = ((MELSpriteHitbox *)self)->sprite;
+        return sprite->animation != NULL
+            ? MELSpriteHitboxGetFrame(sprite, sprite->animation->frame.hitbox)
+            : MELRectangleZero;
+    } else if (class == &MELStaticHitboxClass) {
+        return ((MELStaticHitbox *)self)->frame;
+    }
+    return class->getFrame(self);
+}
+
+static MELBoolean maskCollidesWithHitbox(MELMaskHitbox * _Nonnull self, MELHitbox * _Nonnull other);
+static MELIntRectangle integralRectangle(MELRectangle rectangle);
+static MELBoolean isShape(MELHitbox * _Nonnull self);
+static MELQuadrilateral getQuadrilateral(MELHitbox * _Nonnull self, MELPoint * _Nonnull axes);
+static MELBoolean shapeCollidesWithQuadrilateral(MELHitbox * _Nonnull self, MELQuadrilateral quadrilateral, const MELPoint * _Nonnull axes);
+static MELBoolean shapeCollidesWithHitbox(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other);
 
 MELHitbox * _Nullable MELHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite) {
     MELHitboxType type = MELInputStreamReadByte(inputStream);
@@ -25,6 +58,12 @@ MELHitbox * _Nullable MELHitboxLoad(MELInputStream * _Nonnull inputStream, MELSp
             return MELSpriteHitboxAlloc(sprite);
         case MELHitboxTypeSimpleSpriteHitbox:
             return MELSimpleSpriteHitboxAlloc(sprite);
+        case MELHitboxTypeMaskHitbox:
+            return MELMaskHitboxAlloc(sprite);
+        case MELHitboxTypeOrientedHitbox:
+            return MELOrientedHitboxLoad(inputStream, sprite);
+        case MELHitboxTypeCapsuleHitbox:
+            return MELCapsuleHitboxLoad(inputStream, sprite);
         default:
             playdate->system->error("Unsupported hitbox type: %d", type);
             return NULL;
@@ -38,44 +77,111 @@ void MELHitboxDeinit(MELHitbox * _Nullable self) {
 }
 
 void MELHitboxReaffect(MELHitbox * _Nonnull self, MELSprite * _Nonnull sprite) {
+    MELHitboxInvalidate(self);
     if (self->class == &MELSpriteHitboxClass) {
         MELSpriteHitbox *spriteHitbox = (MELSpriteHitbox *)self;
         spriteHitbox->sprite = sprite;
     } else if (self->class == &MELSimpleSpriteHitboxClass) {
         MELSimpleSpriteHitbox *simpleSpriteHitbox = (MELSimpleSpriteHitbox *)self;
         simpleSpriteHitbox->sprite = sprite;
+    } else if (self->class == &MELMaskHitboxClass) {
+        MELMaskHitbox *maskHitbox = (MELMaskHitbox *)self;
+        maskHitbox->sprite = sprite;
+    } else if (self->class == &MELOrientedHitboxClass) {
+        MELOrientedHitbox *orientedHitbox = (MELOrientedHitbox *)self;
+        if (orientedHitbox->sprite != NULL) {
+            orientedHitbox->sprite = sprite;
+        }
+    } else if (self->class == &MELCapsuleHitboxClass) {
+        MELCapsuleHitbox *capsuleHitbox = (MELCapsuleHitbox *)self;
+        if (capsuleHitbox->sprite != NULL) {
+            capsuleHitbox->sprite = sprite;
+        }
     }
 }
 
 MELRectangle MELHitboxGetFrame(MELHitbox * _Nonnull self) {
-    return self->class->getFrame(self);
+    return getFrame(self);
 }
 
 MELBoolean MELHitboxCollidesWithPoint(MELHitbox * _Nonnull self, MELPoint point) {
-    const MELRectangle frame = self->class->getFrame(self);
-    return point.x >= MELRectangleOriginIsCenterGetLeft(frame) &&
-        point.x < MELRectangleOriginIsCenterGetRight(frame) &&
-        point.y >= MELRectangleOriginIsCenterGetTop(frame) &&
-        point.y < MELRectangleOriginIsCenterGetBottom(frame);
+    const MELBoundingBox boundingBox = MELBoundingBoxMakeWithRectangle(getFrame(self));
+    const MELBoolean collides = point.x >= boundingBox.left &&
+        point.x < boundingBox.right &&
+        point.y >= boundingBox.top &&
+        point.y < boundingBox.bottom;
+    if (collides && self->class == &MELOrientedHitboxClass) {
+        MELPoint axes[2];
+        return MELQuadrilateralContainsPoint(MELOrientedHitboxGetQuadrilateral((MELOrientedHitbox *)self, axes), point);
+    } else if (collides && self->class == &MELCapsuleHitboxClass) {
+        MELCapsuleHitbox *capsuleHitbox = (MELCapsuleHitbox *)self;
+        return MELSegmentDistanceToPoint(MELCapsuleHitboxGetSegment(capsuleHitbox), point) <= capsuleHitbox->radius;
+    } else if (collides && self->class == &MELMaskHitboxClass) {
+        MELIntPoint topLeft;
+        const MELBitmapMask *mask = MELMaskHitboxGetMask((MELMaskHitbox *)self, &topLeft);
+        return mask == NULL || MELBitmapMaskGetPixel(mask, (int) floorf(point.x) - topLeft.x, (int) floorf(point.y) - topLeft.y);
+    }
+    return collides;
 }
 
 MELBoolean MELHitboxCollidesWithRectangle(MELHitbox * _Nonnull self, MELRectangle rectangle) {
-    const MELRectangle frame = self->class->getFrame(self);
-    const MELBoolean x = fabsf(frame.origin.x - rectangle.origin.x) <= (frame.size.width + rectangle.size.width) / 2;
-    const MELBoolean y = fabsf(frame.origin.y - rectangle.origin.y) <= (frame.size.height + rectangle.size.height) / 2;
-    return x && y;
+    if (!MELBoundingBoxIntersects(MELBoundingBoxMakeWithRectangle(getFrame(self)), MELBoundingBoxMakeWithRectangle(rectangle))) {
+        return false;
+    } else if (isShape(self)) {
+        const MELPoint axes[2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+        return shapeCollidesWithQuadrilateral(self, MELQuadrilateralMakeWithRectangle(rectangle), axes);
+    } else if (self->class == &MELMaskHitboxClass) {
+        MELIntPoint topLeft;
+        const MELBitmapMask *mask = MELMaskHitboxGetMask((MELMaskHitbox *)self, &topLeft);
+        return mask == NULL || MELBitmapMaskIntersectsRectangle(mask, topLeft, integralRectangle(rectangle));
+    }
+    return true;
 }
 
 MELBoolean MELHitboxCollidesWithHitbox(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other) {
-    const MELRectangle frame = self->class->getFrame(self);
-    const MELRectangle otherFrame = other->class->getFrame(other);
-    const MELBoolean x = fabsf(frame.origin.x - otherFrame.origin.x) <= (frame.size.width + otherFrame.size.width) / 2;
-    const MELBoolean y = fabsf(frame.origin.y - otherFrame.origin.y) <= (frame.size.height + otherFrame.size.height) / 2;
-    return x && y;
+    return MELBoundingBoxIntersects(MELBoundingBoxMakeWithRectangle(getFrame(self)), MELBoundingBoxMakeWithRectangle(getFrame(other)))
+        && MELHitboxCollidesWithHitboxPrecisely(self, other);
+}
+
+MELBoolean MELHitboxCollidesWithHitboxPrecisely(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other) {
+    if (isShape(self) || isShape(other)) {
+        return shapeCollidesWithHitbox(self, other);
+    } else if (self->class == &MELMaskHitboxClass) {
+        return maskCollidesWithHitbox((MELMaskHitbox *)self, other);
+    } else if (other->class == &MELMaskHitboxClass) {
+        return maskCollidesWithHitbox((MELMaskHitbox *)other, self);
+    }
+    return true;
+}
+
+void MELHitboxNextFrame(void) {
+    const uint32_t frame = MELHitboxFrame + 1;
+    // 0 est réservé aux boîtes invalides.
+    MELHitboxFrame = frame != 0 ? frame : 1;
+}
+
+void MELHitboxInvalidate(MELHitbox * _Nullable self) {
+    if (self != NULL) {
+        self->boundingBoxFrame = 0;
+    }
+}
+
+MELBoundingBox MELHitboxGetBoundingBox(MELHitbox * _Nonnull self) {
+    if (self->boundingBoxFrame != MELHitboxFrame) {
+        self->boundingBox = MELBoundingBoxMakeWithRectangle(getFrame(self));
+        self->boundingBoxFrame = MELHitboxFrame;
+    }
+    return self->boundingBox;
+}
+
+void MELHitboxGetBoundingBoxes(MELHitbox * _Nonnull const * _Nonnull hitboxes, unsigned int count, MELBoundingBox * _Nonnull boundingBoxes) {
+    for (unsigned int index = 0; index < count; index++) {
+        boundingBoxes[index] = MELHitboxGetBoundingBox(hitboxes[index]);
+    }
 }
 
 MELRectangle MELHitboxTopHalfRectangle(MELHitbox * _Nonnull self) {
-    MELRectangle frame = self->class->getFrame(self);
+    MELRectangle frame = getFrame(self);
     return (MELRectangle) {
         .origin = (MELPoint) {
             .x = frame.origin.x,
@@ -89,7 +195,7 @@ MELRectangle MELHitboxTopHalfRectangle(MELHitbox * _Nonnull self) {
 }
 
 MELRectangle MELHitboxBottomQuarterRectangle(MELHitbox * _Nonnull self) {
-    MELRectangle frame = self->class->getFrame(self);
+    MELRectangle frame = getFrame(self);
     return (MELRectangle) {
         .origin = (MELPoint) {
             .x = frame.origin.x,
@@ -101,3 +207,126 @@ MELRectangle MELHitboxBottomQuarterRectangle(MELHitbox * _Nonnull self) {
         }
     };
 }
+
+static MELBoolean maskCollidesWithHitbox(MELMaskHitbox * _Nonnull self, MELHitbox * _Nonnull other) {
+    MELIntPoint topLeft;
+    const MELBitmapMask *mask = MELMaskHitboxGetMask(self, &topLeft);
+    if (mask == NULL) {
+        // Sans image, le cadre du sprite sert de hitbox.
+        return true;
+    }
+    if (other->class == &MELMaskHitboxClass) {
+        MELIntPoint otherTopLeft;
+        const MELBitmapMask *otherMask = MELMaskHitboxGetMask((MELMaskHitbox *)other, &otherTopLeft);
+        if (otherMask != NULL) {
+            return MELBitmapMaskIntersectsMask(mask, topLeft, otherMask, otherTopLeft);
+        }
+    }
+    return MELBitmapMaskIntersectsRectangle(mask, topLeft, integralRectangle(getFrame(other)));
+}
+
+static MELBoolean isShape(MELHitbox * _Nonnull self) {
+    return self->class == &MELOrientedHitboxClass || self->class == &MELCapsuleHitboxClass;
+}
+
+/**
+ * Retourne le rectangle tourné d'un `MELOrientedHitbox` ou le cadre des autres hitbox sous forme de quadrilatère.
+ */
+static MELQuadrilateral getQuadrilateral(MELHitbox * _Nonnull self, MELPoint * _Nonnull axes) {
+    if (self->class == &MELOrientedHitboxClass) {
+        return MELOrientedHitboxGetQuadrilateral((MELOrientedHitbox *)self, axes);
+    }
+    axes[0] = MELPointMake(1.0f, 0.0f);
+    axes[1] = MELPointMake(0.0f, 1.0f);
+    return MELQuadrilateralMakeWithRectangle(getFrame(self));
+}
+
+/**
+ * Test des axes séparateurs entre un `MELOrientedHitbox` ou un `MELCapsuleHitbox` et un rectangle tourné.
+ */
+static MELBoolean shapeCollidesWithQuadrilateral(MELHitbox * _Nonnull self, MELQuadrilateral quadrilateral, const MELPoint * _Nonnull axes) {
+    if (self->class == &MELCapsuleHitboxClass) {
+        MELCapsuleHitbox *capsuleHitbox = (MELCapsuleHitbox *)self;
+        return MELQuadrilateralDistanceToSegment(quadrilateral, axes, MELCapsuleHitboxGetSegment(capsuleHitbox)) <= capsuleHitbox->radius;
+    }
+    MELPoint allAxes[4];
+    const MELQuadrilateral selfQuadrilateral = MELOrientedHitboxGetQuadrilateral((MELOrientedHitbox *)self, allAxes);
+    allAxes[2] = axes[0];
+    allAxes[3] = axes[1];
+    return MELQuadrilateralIntersectsQuadrilateralOnAxes(selfQuadrilateral, quadrilateral, allAxes, 4);
+}
+
+/**
+ * Test précis lorsqu'au moins une des hitbox est un `MELOrientedHitbox` ou un `MELCapsuleHitbox`.
+ * Les `MELMaskHitbox` sont alors considérés comme des rectangles.
+ */
+static MELBoolean shapeCollidesWithHitbox(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other) {
+    if (self->class == &MELCapsuleHitboxClass && other->class == &MELCapsuleHitboxClass) {
+        MELCapsuleHitbox *capsuleHitbox = (MELCapsuleHitbox *)self;
+        MELCapsuleHitbox *otherCapsuleHitbox = (MELCapsuleHitbox *)other;
+        const float distance = MELSegmentDistanceToSegment(MELCapsuleHitboxGetSegment(capsuleHitbox), MELCapsuleHitboxGetSegment(otherCapsuleHitbox));
+        return distance <= capsuleHitbox->radius + otherCapsuleHitbox->radius;
+    }
+    if (!isShape(self) || other->class == &MELCapsuleHitboxClass) {
+        MELHitbox *swap = self;
+        self = other;
+        other = swap;
+    }
+    MELPoint axes[2];
+    const MELQuadrilateral quadrilateral = getQuadrilateral(other, axes);
+    return shapeCollidesWithQuadrilateral(self, quadrilateral, axes);
+}
+
+/**
+ * Retourne les pixels couverts par le rectangle donné.
+ *
+ * @param rectangle Rectangle dont l'origine est le centre.
+ * @return Un rectangle dont l'origine est le coin haut gauche.
+ */
+static MELIntRectangle integralRectangle(MELRectangle rectangle) {
+    const int left = (int) floorf(rectangle.origin.x - rectangle.size.width / 2);
+    const int top = (int) floorf(rectangle.origin.y - rectangle.size.height / 2);
+    const int right = (int) ceilf(rectangle.origin.x + rectangle.size.width / 2);
+    const int bottom = (int) ceilf(rectangle.origin.y + rectangle.size.height / 2);
+    return (MELIntRectangle) {
+        .origin = {left, top},
+        .size = {right - left, bottom - top},
+    };
+}
+
+MELBoundingBox MELBoundingBoxMakeWithRectangle(MELRectangle rectangle) {
+    const float halfWidth = rectangle.size.width / 2;
+    const float halfHeight = rectangle.size.height / 2;
+    return (MELBoundingBox) {
+        .left = rectangle.origin.x - halfWidth,
+        .top = rectangle.origin.y - halfHeight,
+        .right = rectangle.origin.x + halfWidth,
+        .bottom = rectangle.origin.y + halfHeight,
+    };
+}
+
+MELBoolean MELBoundingBoxIntersects(MELBoundingBox self, MELBoundingBox other) {
+    return self.left <= other.right && other.left <= self.right
+        && self.top <= other.bottom && other.top <= self.bottom;
+}
+
+unsigned int MELBoundingBoxFindIntersections(MELBoundingBox self, const MELBoundingBox * _Nonnull others, unsigned int count, unsigned int * _Nonnull indexes) {
+    unsigned int found = 0;
+    for (unsigned int index = 0; index < count; index++) {
+        const MELBoundingBox other = others[index];
+        // Pas de branchement : l'index est toujours écrit mais n'est conservé que si les boîtes se touchent.
+        indexes[found] = index;
+        found += (self.left <= other.right) & (other.left <= self.right)
+            & (self.top <= other.bottom) & (other.top <= self.bottom);
+    }
+    return found;
+}
+
+int MELBoundingBoxIndexOfFirstIntersection(MELBoundingBox self, const MELBoundingBox * _Nonnull others, unsigned int count) {
+    for (unsigned int index = 0; index < count; index++) {
+        if (MELBoundingBoxIntersects(self, others[index])) {
+            return (int) index;
+        }
+    }
+    return -1;
+}
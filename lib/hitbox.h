@@ -25,20 +25,109 @@ typedef struct {
     void (* _Nullable save)(MELHitbox * _Nonnull self, MELOutputStream * _Nonnull outputStream);
 } MELHitboxClass;
 
+/**
+ * Boîte englobante alignée sur les axes, exprimée par ses bords.
+ */
+typedef struct {
+    float left;
+    float top;
+    float right;
+    float bottom;
+} MELBoundingBox;
+
 typedef struct melhitbox {
     const MELHitboxClass * _Nonnull class;
+    /// Boîte englobante en coordonnées du monde, mise en cache par `MELHitboxGetBoundingBox`.
+    MELBoundingBox boundingBox;
+    /// Valeur de `MELHitboxFrame` lors du calcul de `boundingBox`. 0 si le cache est invalide.
+    uint32_t boundingBoxFrame;
 } MELHitbox;
 
+/**
+ * Numéro de la frame en cours pour le cache des boîtes englobantes.
+ */
+extern uint32_t MELHitboxFrame;
+
 MELHitbox * _Nullable MELHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite);
 void MELHitboxDeinit(MELHitbox * _Nullable self);
 void MELHitboxReaffect(MELHitbox * _Nonnull self, MELSprite * _Nonnull sprite);
 
 MELRectangle MELHitboxGetFrame(MELHitbox * _Nonnull self);
+
+// Les tests suivants lisent toujours la position courante de la hitbox. Seul le monde de collision
+// utilise la boîte englobante en cache (voir `MELHitboxGetBoundingBox`).
 MELBoolean MELHitboxCollidesWithPoint(MELHitbox * _Nonnull self, MELPoint point);
 MELBoolean MELHitboxCollidesWithRectangle(MELHitbox * _Nonnull self, MELRectangle rectangle);
 MELBoolean MELHitboxCollidesWithHitbox(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other);
 
+/**
+ * Test précis à faire lorsque les boîtes englobantes des deux hitbox se touchent.
+ * Compare les masques des `MELMaskHitbox` et teste les axes séparateurs des `MELOrientedHitbox` et `MELCapsuleHitbox`.
+ * Pour les hitbox rectangulaires, retourne toujours vrai.
+ *
+ * @param self Première hitbox.
+ * @param other Seconde hitbox.
+ * @return true si les hitbox se touchent.
+ */
+MELBoolean MELHitboxCollidesWithHitboxPrecisely(MELHitbox * _Nonnull self, MELHitbox * _Nonnull other);
+
+/**
+ * Invalide les boîtes englobantes de toutes les hitbox.
+ *
+ * Appelé au début de `MELCollisionWorldUpdate`. Sans monde de collision, il faut l'appeler une fois par frame,
+ * après le déplacement des sprites et avant les tests de collision.
+ */
+void MELHitboxNextFrame(void);
+
+/**
+ * Invalide la boîte englobante de la hitbox donnée.
+ * Appelé par les fonctions de déplacement et de changement d'animation de `MELSprite`.
+ * À appeler après avoir modifié directement `sprite->frame` si la boîte englobante est lue dans la même frame.
+ *
+ * @param self Hitbox à invalider.
+ */
+void MELHitboxInvalidate(MELHitbox * _Nullable self);
+
+/**
+ * Retourne la boîte englobante de la hitbox donnée.
+ * Elle n'est calculée qu'une fois par frame, tant que la hitbox n'est pas invalidée.
+ *
+ * @param self Hitbox.
+ * @return La boîte englobante de la hitbox en coordonnées du monde.
+ */
+MELBoundingBox MELHitboxGetBoundingBox(MELHitbox * _Nonnull self);
+
+/**
+ * Remplit `boundingBoxes` avec la boîte englobante de chaque hitbox.
+ *
+ * @param hitboxes Hitbox à lire.
+ * @param count Nombre de hitbox.
+ * @param boundingBoxes Tableau de `count` éléments à remplir.
+ */
+void MELHitboxGetBoundingBoxes(MELHitbox * _Nonnull const * _Nonnull hitboxes, unsigned int count, MELBoundingBox * _Nonnull boundingBoxes);
+
 MELRectangle MELHitboxTopHalfRectangle(MELHitbox * _Nonnull self);
 MELRectangle MELHitboxBottomQuarterRectangle(MELHitbox * _Nonnull self);
 
+MELBoundingBox MELBoundingBoxMakeWithRectangle(MELRectangle rectangle);
+MELBoolean MELBoundingBoxIntersects(MELBoundingBox self, MELBoundingBox other);
+
+/**
+ * Cherche les boîtes de `others` qui touchent `self`.
+ *
+ * @param self Boîte à tester.
+ * @param others Boîtes à comparer.
+ * @param count Nombre de boîtes dans `others`.
+ * @param indexes Tableau d'au moins `count` éléments recevant les index des boîtes touchées.
+ * @return Le nombre d'index écrits dans `indexes`.
+ */
+unsigned int MELBoundingBoxFindIntersections(MELBoundingBox self, const MELBoundingBox * _Nonnull others, unsigned int count, unsigned int * _Nonnull indexes);
+
+/**
+ * Retourne l'index de la première boîte de `others` qui touche `self`.
+ *
+ * @return L'index de la première boîte touchée ou -1 si aucune ne touche `self`.
+ */
+int MELBoundingBoxIndexOfFirstIntersection(MELBoundingBox self, const MELBoundingBox * _Nonnull others, unsigned int count);
+
 #endif /* hitbox_h */
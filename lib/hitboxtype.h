@@ -12,6 +12,9 @@ typedef enum {
     MELHitboxTypeStaticHitbox,
     MELHitboxTypeSpriteHitbox,
     MELHitboxTypeSimpleSpriteHitbox,
+    MELHitboxTypeMaskHitbox,
+    MELHitboxTypeOrientedHitbox,
+    MELHitboxTypeCapsuleHitbox,
 } MELHitboxType;
 
 #endif /* hitboxtype_h */
@@ -35,7 +35,7 @@ static void update(LCDSprite * _Nonnull sprite) {
     const MELPoint origin = self->frame.origin;
     const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
+    MELSpritePushPosition(self, sprite, x, y);
 }
 
 static void setOriginWithAlignment(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, MELPoint origin, MELHorizontalAlignment horizontalAlignment, MELVerticalAlignment verticalAlignment) {
@@ -62,7 +62,8 @@ static void setOriginWithAlignment(MELSprite * _Nonnull self, LCDSprite * _Nonnu
     }
 
     self->frame.origin = origin;
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(origin));
+    MELHitboxInvalidate(self->hitbox);
+    MELSpritePushPosition(self, sprite, origin.x, origin.y);
 }
 
 void MELImageSetStatic(LCDSprite * _Nonnull sprite, MELPoint origin, MELHorizontalAlignment horizontalAlignment, MELVerticalAlignment verticalAlignment) {
@@ -78,6 +79,7 @@ void MELImageSetSpritePaletteImageIndex(LCDSprite * _Nonnull sprite, int imageIn
     }
     LCDBitmapTable *palette = self->userdata;
     playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(palette, imageIndex), kBitmapUnflipped);
+    MELSpriteInvalidatePushedState(self);
 }
 
 LCDSprite * _Nonnull MELImageConstructor(MELPoint origin, LCDBitmap * _Nonnull image) {
@@ -147,7 +149,7 @@ LCDSprite * _Nonnull MELImageConstructorWithSelfDontPush(MELSprite * _Nonnull se
     playdate->sprite->setUpdateFunction(sprite, &update);
     playdate->sprite->setImage(sprite, image, kBitmapUnflipped);
     playdate->sprite->setUserdata(sprite, self);
-    playdate->sprite->moveTo(sprite, MOVETO_XY(origin.x - camera.frame.origin.x, origin.y - camera.frame.origin.y));
+    MELSpritePushPosition(self, sprite, origin.x - camera.frame.origin.x, origin.y - camera.frame.origin.y);
     playdate->sprite->addSprite(sprite);
 
     return sprite;
@@ -15,6 +15,8 @@
 #include "files.h"
 
 #define MELInputStreamBufferSize 4096
+/// Les chaînes plus courtes sont lues en UTF-16 sur la pile.
+#define MELInputStreamStringStackCapacity 128
 
 MELBoolean MELFileExists(const char * _Nonnull path) {
     FileStat stat;
@@ -336,12 +338,18 @@ uint32_t * _Nonnull MELInputStreamReadUInt32Array(MELInputStream * _Nonnull self
 char * _Nonnull MELInputStreamReadString(MELInputStream * _Nonnull self) {
     int32_t count = MELInputStreamReadInt(self);
 
-    uint16_t *string = playdate->system->realloc(NULL, sizeof(uint16_t) * (count + 1));
-    MELInputStreamRead(self, string, sizeof(uint16_t) * count);
-    string[count] = '\0';
-
-    char *utf8String = MELUTF8StringMakeWithUTF16String(string);
-    playdate->system->realloc(string, 0);
+    MELChar16 stackString[MELInputStreamStringStackCapacity];
+    MELChar16 *string = count <= MELInputStreamStringStackCapacity
+        ? stackString
+        : playdate->system->realloc(NULL, sizeof(MELChar16) * count);
+    MELInputStreamRead(self, string, sizeof(MELChar16) * count);
+
+    const unsigned int length = MELUTF8StringMakeWithUTF16StringAndBuffer(string, count, NULL, 0);
+    char *utf8String = playdate->system->realloc(NULL, length + 1);
+    MELUTF8StringMakeWithUTF16StringAndBuffer(string, count, utf8String, length + 1);
+    if (string != stackString) {
+        playdate->system->realloc(string, 0);
+    }
 
     return utf8String;
 }
@@ -12,12 +12,20 @@
 
 #include "list.h"
 
-#define LOAD_FACTOR 0.75
-#define DEFAULT_BUCKET_COUNT 16
+/// Capacité minimale d'une table. Toujours une puissance de 2 et un multiple de 8.
+#define MELKeyValueTableMinimumCapacity 16
+
+/// Une table est agrandie dès qu'elle est remplie aux 3/4.
+#define MELKeyValueTableIsOverloaded(count, capacity) ((count) * 4 > (capacity) * 3)
+
+#define MELKeyValueTableIsOccupied(occupied, index) ((occupied)[(index) >> 3] & (1 << ((index) & 7)))
 
 // Definition macro
 
-// Remplacer les buckets par un typedef ? typedef MELList(K##V##TableEntry) K##V##TableBucket; ?
+/*
+ * Table à adressage ouvert pour des clés comparables avec == (entiers, pointeurs).
+ * Les entrées et le masque des cases occupées sont dans une seule allocation.
+ */
 
 #define MELKeyValueTableDefine(K, V) typedef struct {\
     K key;\
@@ -26,14 +34,12 @@
 \
 MELListDefine(K##V##TableEntry);\
 \
-typedef struct {\
-    MELList(K##V##TableEntry) entries;\
-} K##V##TableBucket;\
-\
-MELListDefine(K##V##TableBucket);\
-\
-/** Table with string keys and V values. */ typedef struct {\
-    MELList(K##V##TableBucket) buckets;\
+/** Table with K keys and V values. */ typedef struct {\
+    /** Slots of the table. `capacity` is always 0 or a power of 2. */\
+    K##V##TableEntry * _Nullable entries;\
+    /** One bit per slot, set when the slot is occupied. Stored right after `entries`. */\
+    uint8_t * _Nullable occupied;\
+    unsigned int capacity;\
     unsigned int count;\
 } K##V##Table;\
 \
@@ -46,56 +52,79 @@ MELBoolean K##V##TableGet(K##V##Table self, K key, V * _Nonnull value);\
 MELBoolean K##V##TableContains(K##V##Table self, K key);\
 void K##V##TableRemove(K##V##Table * _Nonnull self, K key);\
 MELBoolean K##V##TableRemoveAndGetOldValue(K##V##Table * _Nonnull self, K key, V * _Nullable oldValue);\
+/** Iterates over the entries without allocating. Start with *cursor = 0 and call until it returns false. The table must not be modified meanwhile. */\
+MELBoolean K##V##TableNextEntry(const K##V##Table * _Nonnull self, unsigned int * _Nonnull cursor, K##V##TableEntry * _Nonnull entry);\
 K##V##TableEntryList K##V##TableEntries(K##V##Table * _Nonnull self);
 
 // Implementation macro
 
 #define MELKeyValueTableImplement(K, V) const K##V##Table K##V##TableEmpty = {};\
 \
-MELListImplement(K##V##TableBucket);\
 MELListImplement(K##V##TableEntry);\
 \
+/** Mixes every bit of the key into the low bits used to find the slot (murmur3 finalizer). */\
+uint32_t K##V##TableHash(K key) {\
+    uint64_t value = (uint64_t) key;\
+    uint32_t hash = (uint32_t) value ^ (uint32_t) (value >> 32);\
+    hash ^= hash >> 16;\
+    hash *= 0x85ebca6b;\
+    hash ^= hash >> 13;\
+    hash *= 0xc2b2ae35;\
+    hash ^= hash >> 16;\
+    return hash;\
+}\
+\
 void K##V##TableDeinit(K##V##Table * _Nonnull self) {\
-    for (unsigned int bucketIndex = 0; bucketIndex < self->buckets.capacity; bucketIndex++) {\
-        K##V##TableBucket bucket = self->buckets.memory[bucketIndex];\
-        if (bucket.entries.memory != NULL) {\
-            K##V##TableEntryListDeinit(&self->buckets.memory[bucketIndex].entries);\
-        }\
-    }\
-    K##V##TableBucketListDeinit(&self->buckets);\
-    self->count = 0;\
+    playdate->system->realloc(self->entries, 0);\
+    *self = K##V##TableEmpty;\
 }\
 \
 void K##V##TableClear(K##V##Table * _Nonnull self) {\
-    MELList(K##V##TableBucket) buckets = self->buckets;\
-    for (unsigned int bucketIndex = 0; bucketIndex < buckets.capacity; bucketIndex++) {\
-        buckets.memory[bucketIndex].entries.count = 0;\
+    if (self->occupied != NULL) {\
+        memset(self->occupied, 0, self->capacity / 8);\
     }\
     self->count = 0;\
 }\
 \
-void K##V##TableGrowAndRehash(K##V##Table * _Nonnull self) {\
-    K##V##TableBucketList oldBuckets = self->buckets;\
-    const unsigned int newCapacity = oldBuckets.capacity == 0 ? DEFAULT_BUCKET_COUNT : oldBuckets.capacity * 2;\
-    K##V##TableBucketList newBuckets = K##V##TableBucketListMakeWithInitialCapacity(newCapacity);\
-    if (newBuckets.memory == NULL) {\
-        playdate->system->error("Unable to grow dictionary of V to capacity %lu\n", newCapacity);\
+void K##V##TableRehash(K##V##Table * _Nonnull self, unsigned int newCapacity) {\
+    K##V##TableEntry *newEntries = playdate->system->realloc(NULL, sizeof(K##V##TableEntry) * newCapacity + newCapacity / 8);\
+    if (newEntries == NULL) {\
+        playdate->system->error("Unable to grow table of V to capacity %u\n", newCapacity);\
         return;\
     }\
-    memset(newBuckets.memory, 0, sizeof(K##V##TableBucketList) * newBuckets.capacity);\
-    newBuckets.count = oldBuckets.count;\
-    for (unsigned int bucketIndex = 0; bucketIndex < oldBuckets.capacity; bucketIndex++) {\
-        K##V##TableBucket oldBucket = oldBuckets.memory[bucketIndex];\
-        for (unsigned int entryIndex = 0; entryIndex < oldBucket.entries.count; entryIndex++) {\
-            K##V##TableEntry entry = oldBucket.entries.memory[entryIndex];\
-\
-            unsigned int newBucketIndex = entry.key % newBuckets.capacity;\
-            K##V##TableEntryListPush(&newBuckets.memory[newBucketIndex].entries, entry);\
+    uint8_t *newOccupied = (uint8_t *) (newEntries + newCapacity);\
+    memset(newOccupied, 0, newCapacity / 8);\
+    const unsigned int newMask = newCapacity - 1;\
+    for (unsigned int index = 0; index < self->capacity; index++) {\
+        if (MELKeyValueTableIsOccupied(self->occupied, index)) {\
+            const K##V##TableEntry entry = self->entries[index];\
+            unsigned int newIndex = K##V##TableHash(entry.key) & newMask;\
+            while (MELKeyValueTableIsOccupied(newOccupied, newIndex)) {\
+                newIndex = (newIndex + 1) & newMask;\
+            }\
+            newEntries[newIndex] = entry;\
+            newOccupied[newIndex >> 3] |= 1 << (newIndex & 7);\
+        }\
+    }\
+    playdate->system->realloc(self->entries, 0);\
+    self->entries = newEntries;\
+    self->occupied = newOccupied;\
+    self->capacity = newCapacity;\
+}\
+\
+int K##V##TableIndexOfKey(const K##V##Table * _Nonnull self, K key) {\
+    if (self->entries == NULL) {\
+        return -1;\
+    }\
+    const unsigned int mask = self->capacity - 1;\
+    unsigned int index = K##V##TableHash(key) & mask;\
+    while (MELKeyValueTableIsOccupied(self->occupied, index)) {\
+        if (self->entries[index].key == key) {\
+            return (int) index;\
         }\
-        K##V##TableEntryListDeinit(&oldBucket.entries);\
+        index = (index + 1) & mask;\
     }\
-    self->buckets = newBuckets;\
-    K##V##TableBucketListDeinit(&oldBuckets);\
+    return -1;\
 }\
 \
 void K##V##TablePut(K##V##Table * _Nonnull self, K key, V value) {\
@@ -103,70 +132,43 @@ void K##V##TablePut(K##V##Table * _Nonnull self, K key, V value) {\
 }\
 \
 MELBoolean K##V##TablePutAndGetOldValue(K##V##Table * _Nonnull self, K key, V value, V * _Nullable oldValue) {\
-    if (self->buckets.memory == NULL) {\
-        self->buckets.capacity = 0;\
-        K##V##TableGrowAndRehash(self);\
-        if (!self->buckets.capacity) {\
+    if (self->capacity == 0 || MELKeyValueTableIsOverloaded(self->count + 1, self->capacity)) {\
+        K##V##TableRehash(self, self->capacity == 0 ? MELKeyValueTableMinimumCapacity : self->capacity * 2);\
+        if (self->entries == NULL) {\
             /* Unable to put the value. */\
             return false;\
         }\
     }\
-    const unsigned int bucketIndex = key % self->buckets.capacity;\
-    K##V##TableBucket bucket = self->buckets.memory[bucketIndex];\
-    if (bucket.entries.count > 0 && bucket.entries.memory != NULL) {\
-        for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-            K##V##TableEntry entry = bucket.entries.memory[entryIndex];\
-            if (entry.key == key) {\
-                if (oldValue) {\
-                    *oldValue = entry.value;\
-                }\
-                entry.value = value;\
-                return true;\
+    const unsigned int mask = self->capacity - 1;\
+    unsigned int index = K##V##TableHash(key) & mask;\
+    while (MELKeyValueTableIsOccupied(self->occupied, index)) {\
+        K##V##TableEntry *entry = self->entries + index;\
+        if (entry->key == key) {\
+            if (oldValue) {\
+                *oldValue = entry->value;\
             }\
+            entry->value = value;\
+            return true;\
         }\
+        index = (index + 1) & mask;\
     }\
-    if (bucket.entries.count == 0 || bucket.entries.memory == NULL) {\
-        self->buckets.count++;\
-    }\
+    self->entries[index] = (K##V##TableEntry) {key, value};\
+    self->occupied[index >> 3] |= 1 << (index & 7);\
     self->count++;\
-    K##V##TableEntryListPush(&self->buckets.memory[bucketIndex].entries, (K##V##TableEntry) {key, value});\
-\
-    const double loadFactor = self->count / (double) self->buckets.capacity;\
-    if (loadFactor >= LOAD_FACTOR) {\
-        K##V##TableGrowAndRehash(self);\
-    }\
     return false;\
 }\
 \
 MELBoolean K##V##TableGet(K##V##Table self, K key, V * _Nonnull value) {\
-    if (self.buckets.memory == 0 || self.buckets.memory == NULL) {\
+    const int index = K##V##TableIndexOfKey(&self, key);\
+    if (index < 0) {\
         return false;\
     }\
-    unsigned int bucketIndex = key % self.buckets.capacity;\
-    K##V##TableBucket bucket = self.buckets.memory[bucketIndex];\
-    for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-        K##V##TableEntry entry = bucket.entries.memory[entryIndex];\
-        if (entry.key == key) {\
-            *value = entry.value;\
-            return true;\
-        }\
-    }\
-    return false;\
+    *value = self.entries[index].value;\
+    return true;\
 }\
 \
 MELBoolean K##V##TableContains(K##V##Table self, K key) {\
-    if (self.buckets.memory == 0 || self.buckets.memory == NULL) {\
-        return false;\
-    }\
-    unsigned int bucketIndex = key % self.buckets.capacity;\
-    K##V##TableBucket bucket = self.buckets.memory[bucketIndex];\
-    for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-        K##V##TableEntry entry = bucket.entries.memory[entryIndex];\
-        if (entry.key == key) {\
-            return true;\
-        }\
-    }\
-    return false;\
+    return K##V##TableIndexOfKey(&self, key) >= 0;\
 }\
 \
 void K##V##TableRemove(K##V##Table * _Nonnull self, K key) {\
@@ -174,35 +176,48 @@ void K##V##TableRemove(K##V##Table * _Nonnull self, K key) {\
 }\
 \
 MELBoolean K##V##TableRemoveAndGetOldValue(K##V##Table * _Nonnull self, K key, V * _Nullable oldValue) {\
-    if (self->buckets.memory == 0 || self->buckets.memory == NULL) {\
+    const int removedIndex = K##V##TableIndexOfKey(self, key);\
+    if (removedIndex < 0) {\
         return false;\
     }\
-    unsigned int bucketIndex = key % self->buckets.capacity;\
-    K##V##TableBucket bucket = self->buckets.memory[bucketIndex];\
-    for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-        K##V##TableEntry entry = bucket.entries.memory[entryIndex];\
-        if (entry.key == key) {\
-            K##V##TableEntryListRemove(&self->buckets.memory[bucketIndex].entries, entryIndex);\
-            self->count--;\
-            if (oldValue) {\
-                *oldValue = entry.value;\
-            }\
+    if (oldValue) {\
+        *oldValue = self->entries[removedIndex].value;\
+    }\
+    /* Décalage arrière : une entrée suivante prend la case libérée si sa place idéale n'est pas entre la case libérée et elle. */\
+    const unsigned int mask = self->capacity - 1;\
+    unsigned int hole = (unsigned int) removedIndex;\
+    unsigned int index = (hole + 1) & mask;\
+    while (MELKeyValueTableIsOccupied(self->occupied, index)) {\
+        const unsigned int home = K##V##TableHash(self->entries[index].key) & mask;\
+        if (((index - home) & mask) >= ((index - hole) & mask)) {\
+            self->entries[hole] = self->entries[index];\
+            hole = index;\
+        }\
+        index = (index + 1) & mask;\
+    }\
+    self->occupied[hole >> 3] &= ~(1 << (hole & 7));\
+    self->count--;\
+    return true;\
+}\
+\
+MELBoolean K##V##TableNextEntry(const K##V##Table * _Nonnull self, unsigned int * _Nonnull cursor, K##V##TableEntry * _Nonnull entry) {\
+    for (unsigned int index = *cursor; index < self->capacity; index++) {\
+        if (MELKeyValueTableIsOccupied(self->occupied, index)) {\
+            *entry = self->entries[index];\
+            *cursor = index + 1;\
             return true;\
         }\
     }\
+    *cursor = self->capacity;\
     return false;\
 }\
 \
 K##V##TableEntryList K##V##TableEntries(K##V##Table * _Nonnull self) {\
     K##V##TableEntryList entries = K##V##TableEntryListMakeWithInitialCapacity(self->count);\
-\
-    K##V##TableBucketList buckets = self->buckets;\
-    for (unsigned int bucketIndex = 0; bucketIndex < buckets.capacity; bucketIndex++) {\
-        K##V##TableBucket bucket = buckets.memory[bucketIndex];\
-        for (unsigned int entryIndex = 0; entryIndex < bucket.entries.count; entryIndex++) {\
-            K##V##TableEntry entry = bucket.entries.memory[entryIndex];\
-            K##V##TableEntryListPush(&entries, entry);\
-        }\
+    unsigned int cursor = 0;\
+    K##V##TableEntry entry;\
+    while (K##V##TableNextEntry(self, &cursor, &entry)) {\
+        K##V##TableEntryListPush(&entries, entry);\
     }\
     return entries;\
 }
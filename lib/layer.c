@@ -8,6 +8,7 @@
 #include "layer.h"
 
 #include "map.h"
+#include "trigtable.h"
 
 MELListImplement(MELLayerRef);
 
@@ -22,22 +23,25 @@ void MELLayerDeinit(MELLayer * _Nonnull self) {
 }
 
 uint16_t MELLayerTileAtXAndY(MELLayer * _Nonnull self, float x, float y) {
-    const MELIntSize tileSize = self->parent->tileSize;
+    const MELMap *map = self->parent;
+    const MELIntSize tileSize = map->tileSize;
     const MELIntRectangle frame = self->frame;
     const float left = frame.origin.x * tileSize.width;
     const float top = frame.origin.y * tileSize.height;
     const float right = left + frame.size.width * tileSize.width;
     const float bottom = top + frame.size.height * tileSize.height;
-#define kTileY ((int) (y / tileSize.height) - frame.origin.y)
-#define kTileX ((int) (x / tileSize.width) - frame.origin.x)
+#define kTileY (MELIntDividerDivide(&map->tileHeightDivider, (int) y) - frame.origin.y)
+#define kTileX (MELIntDividerDivide(&map->tileWidthDivider, (int) x) - frame.origin.x)
     return x >= left && x < right && y >= top && y < bottom
         ? self->tiles[kTileY * frame.size.width + kTileX]
         : kEmptyTile;
 }
 
 MELIntPoint MELLayerPointInTileAtPoint(MELLayer * _Nonnull self, MELPoint point) {
-    const MELIntSize tileSize = self->parent->tileSize;
-    return MELIntPointMake(((int)point.x) % tileSize.width, ((int)point.y) % tileSize.height);
+    const MELMap *map = self->parent;
+    const int x = (int) point.x;
+    const int y = (int) point.y;
+    return MELIntPointMake(MELIntDividerModulo(&map->tileWidthDivider, x), MELIntDividerModulo(&map->tileHeightDivider, y));
 }
 
 MELBoolean MELLayerCollidesWithPoint(MELLayer * _Nonnull self, uint16_t tile, MELIntPoint pointInsideTile) {
@@ -52,16 +56,17 @@ MELBoolean MELLayerCollidesWithPoint(MELLayer * _Nonnull self, uint16_t tile, ME
 }
 
 GLfloat MELLayerTileTop(MELLayer * _Nonnull self, MELPoint point) {
-    MELIntSize tileSize = self->parent->tileSize;
-    return ((int)point.y / tileSize.height) * tileSize.height;
+    const MELMap *map = self->parent;
+    return MELIntDividerDivide(&map->tileHeightDivider, (int)point.y) * map->tileSize.height;
 }
 GLfloat MELLayerTileBottom(MELLayer * _Nonnull self, MELPoint point) {
-    MELIntSize tileSize = self->parent->tileSize;
-    return ((int)point.y / tileSize.height) * tileSize.height + tileSize.height;
+    const MELMap *map = self->parent;
+    const int tileHeight = map->tileSize.height;
+    return MELIntDividerDivide(&map->tileHeightDivider, (int)point.y) * tileHeight + tileHeight;
 }
 GLfloat MELLayerTileBorder(MELLayer * _Nonnull self, MELPoint point, MELDirection direction) {
-    const MELIntSize tileSize = self->parent->tileSize;
-    return (GLfloat) (((int) point.x / tileSize.width) + (int) direction) * tileSize.width;
+    const MELMap *map = self->parent;
+    return (GLfloat) (MELIntDividerDivide(&map->tileWidthDivider, (int) point.x) + (int) direction) * map->tileSize.width;
 }
 
 GLfloat MELLayerAngleAtPoint(MELLayer * _Nonnull self, MELPoint point, MELDirection direction) {
@@ -71,7 +76,7 @@ GLfloat MELLayerAngleAtPoint(MELLayer * _Nonnull self, MELPoint point, MELDirect
     const GLfloat backY = self->parent->xHitbox(tile, pixel.x);
     const GLfloat frontY = self->parent->xHitbox(tile, pixel.x + MELDirectionValues[direction]);
 
-    return atan2f(frontY - backY, MELDirectionValues[direction]);
+    return MELTrigTableAtan2(frontY - backY, MELDirectionValues[direction]);
 }
 
 GLfloat MELLayerVerticalAngleAtPoint(MELLayer * _Nonnull self, MELPoint point, MELDirection direction) {
@@ -81,5 +86,5 @@ GLfloat MELLayerVerticalAngleAtPoint(MELLayer * _Nonnull self, MELPoint point, M
     const GLfloat backX = self->parent->yHitbox(tile, pixel.y);
     const GLfloat frontX = self->parent->yHitbox(tile, pixel.y + MELDirectionValues[direction]);
 
-    return atan2f(MELDirectionValues[direction], frontX - backX);
+    return MELTrigTableAtan2(MELDirectionValues[direction], frontX - backX);
 }
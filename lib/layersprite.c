@@ -106,6 +106,7 @@ LCDSprite * _Nonnull MELLayerSpriteConstructorWithInstance(MELSpriteInstance ins
 
     LCDSprite *sprite = playdate->sprite->newSprite();
     playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(definition->palette, 0), kBitmapUnflipped);
+    MELSpriteInvalidatePushedState(&self->super);
     playdate->sprite->setUserdata(sprite, self);
     playdate->sprite->addSprite(sprite);
     playdate->sprite->setUpdateFunction(sprite, updateRepeat);
@@ -134,7 +135,7 @@ static void update(LCDSprite * _Nonnull sprite) {
 
     const float x = frame.origin.x + self->leftPadding - camera.frame.origin.x * scrollRate.x + frame.size.width / 2.0f;
     const float y = frame.origin.y - camera.frame.origin.y * scrollRate.y + frame.size.height / 2.0f;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
+    MELSpritePushPosition(&self->super, sprite, x, y);
 }
 
 /**
@@ -152,5 +153,5 @@ static void updateRepeat(LCDSprite * _Nonnull sprite) {
 
     const float x = left + leftPadding + frame.size.width / 2.0f;
     const float y = frame.origin.y - camera.frame.origin.y * scrollRate.y + frame.size.height / 2.0f;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
+    MELSpritePushPosition(&self->super, sprite, x, y);
 }
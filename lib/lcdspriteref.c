@@ -11,6 +11,7 @@
 
 MELListImplement(LCDSpriteRef);
 MELListImplementIndexOf(LCDSpriteRef);
+MELSlotMapImplement(LCDSpriteRef);
 
 void LCDSpriteRefListDeallocReverse(LCDSpriteRefList * _Nonnull self) {
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
@@ -31,6 +32,16 @@ void LCDSpriteRefListDeallocReverse(LCDSpriteRefList * _Nonnull self) {
     LCDSpriteRefListDeinit(self);
 }
 
+void LCDSpriteRefSlotMapDeallocReverse(LCDSpriteRefSlotMap * _Nonnull self) {
+    const LCDSpriteRefList sprites = self->values;
+    for (int index = sprites.count - 1; index >= 0; index--) {
+        LCDSprite *sprite = sprites.memory[index];
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+        melSprite->class->destroy(sprite);
+    }
+    LCDSpriteRefSlotMapDeinit(self);
+}
+
 void LCDSpriteDeinit(LCDSprite * _Nonnull sprite) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
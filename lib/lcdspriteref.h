@@ -11,13 +11,16 @@
 #include "melstd.h"
 
 #include "list.h"
+#include "slotmap.h"
 
 typedef LCDSprite * _Nullable LCDSpriteRef;
 
 MELListDefine(LCDSpriteRef);
 MELListDefineIndexOf(LCDSpriteRef);
+MELSlotMapDefine(LCDSpriteRef);
 
 void LCDSpriteRefListDeallocReverse(LCDSpriteRefList * _Nonnull self);
+void LCDSpriteRefSlotMapDeallocReverse(LCDSpriteRefSlotMap * _Nonnull self);
 
 void LCDSpriteDeinit(LCDSprite * _Nonnull sprite);
 void LCDSpriteRefDeinit(LCDSpriteRef * _Nonnull self);
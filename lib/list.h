@@ -15,6 +15,9 @@
 
 #define MELList(type) type##List
 
+/// Capacité d'une liste pleine après agrandissement. Le facteur est donné par `MELLIST_GROWTH_PERCENT` dans melstd.h.
+#define MELListNextCapacity(capacity) ((unsigned int) ((uint64_t) (capacity) * MELLIST_GROWTH_PERCENT / 100) + 4)
+
 #define MELListReference(type) /** List of type */ typedef struct mellist_##type { \
 /** Content of the list. */ \
 type * _Nullable memory; \
@@ -46,14 +49,26 @@ void type##ListDeinit(type##List * _Nonnull self);\
 void type##ListDeinitWithDeinitFunction(type##List * _Nonnull self, void (* _Nonnull deinitFunction)(type * _Nonnull));\
 void type##ListGrow(type##List * _Nonnull self, unsigned int size);\
 void type##ListEnsureCapacity(type##List * _Nonnull self, unsigned int required);\
+/** Grows the list to hold at least capacity elements without any further allocation. */\
+void type##ListReserve(type##List * _Nonnull self, unsigned int capacity);\
+/** Releases the unused capacity. */\
+void type##ListShrinkToFit(type##List * _Nonnull self);\
 void type##ListPush(type##List * _Nonnull self, type element);\
+void type##ListPushN(type##List * _Nonnull self, const type * _Nonnull elements, unsigned int count);\
+/** Adds count elements at the end of the list and returns them. Their content is undefined. */\
+type * _Nonnull type##ListAppendUninitialised(type##List * _Nonnull self, unsigned int count);\
 type type##ListPop(type##List * _Nonnull self);\
 type type##ListGet(type##List self, unsigned int index);\
 type type##ListSet(type##List * _Nonnull self, unsigned int index, type element);\
 void type##ListAddAll(type##List * _Nonnull self, type##List other);\
 void type##ListInsert(type##List * _Nonnull self, unsigned int index, type element);\
 type type##ListRemove(type##List * _Nonnull self, unsigned int index);\
-type type##ListRemoveSwap(type##List * _Nonnull self, unsigned int index);
+type type##ListRemoveSwap(type##List * _Nonnull self, unsigned int index);\
+/** Removes every element matching predicate in a single pass, keeping the order of the others. Returns the number of removed elements. */\
+unsigned int type##ListRemoveIf(type##List * _Nonnull self, MELBoolean (* _Nonnull predicate)(type * _Nonnull element, void * _Nullable userdata), void * _Nullable userdata);\
+void type##ListSwap(type##List * _Nonnull self, unsigned int index, unsigned int otherIndex);\
+/** Empties the list but keeps its memory. */\
+void type##ListClear(type##List * _Nonnull self);
 
 #define MELListDefineIndexOf(type) \
 int type##ListIndexOf(type##List self, type entry);\
@@ -126,14 +141,41 @@ void type##ListGrow(type##List * _Nonnull self, unsigned int size) {\
 }\
 void type##ListEnsureCapacity(type##List * _Nonnull self, unsigned int required) {\
     if (self->capacity < required) { \
-        const unsigned int newCapacity = self->capacity + (self->capacity * 2) + 1; \
+        const unsigned int newCapacity = MELListNextCapacity(self->capacity); \
         type##ListGrow(self, newCapacity > required ? newCapacity : required); \
     } \
 }\
+void type##ListReserve(type##List * _Nonnull self, unsigned int capacity) {\
+    if (self->capacity < capacity) {\
+        type##ListGrow(self, capacity);\
+    }\
+}\
+void type##ListShrinkToFit(type##List * _Nonnull self) {\
+    if (self->count == self->capacity) {\
+        return;\
+    }\
+    if (self->count == 0) {\
+        type##ListDeinit(self);\
+        return;\
+    }\
+    type##ListGrow(self, self->count);\
+}\
 void type##ListPush(type##List * _Nonnull self, type element) {\
     type##ListEnsureCapacity(self, self->count + 1); \
     self->memory[self->count++] = element; \
 }\
+void type##ListPushN(type##List * _Nonnull self, const type * _Nonnull elements, unsigned int count) {\
+    if (count == 0) {\
+        return;\
+    }\
+    memcpy(type##ListAppendUninitialised(self, count), elements, sizeof(type) * count);\
+}\
+type * _Nonnull type##ListAppendUninitialised(type##List * _Nonnull self, unsigned int count) {\
+    type##ListEnsureCapacity(self, self->count + count);\
+    type *elements = self->memory + self->count;\
+    self->count += count;\
+    return elements;\
+}\
 type type##ListPop(type##List * _Nonnull self) {\
     return self->memory[--self->count];\
 }\
@@ -163,12 +205,7 @@ void type##ListInsert(type##List * _Nonnull self, unsigned int index, type eleme
     self->count++;\
 }\
 void type##ListAddAll(type##List * _Nonnull self, type##List other) {\
-    if (other.count == 0) {\
-        return;\
-    }\
-    type##ListEnsureCapacity(self, self->count + other.count); \
-    memcpy(self->memory + self->count, other.memory, sizeof(type) * other.count);\
-    self->count += other.count;\
+    type##ListPushN(self, other.memory, other.count);\
 }\
 type type##ListRemove(type##List * _Nonnull self, unsigned int index) {\
     const type oldValue = self->memory[index];\
@@ -179,6 +216,29 @@ type type##ListRemoveSwap(type##List * _Nonnull self, unsigned int index) {\
     const type oldValue = self->memory[index];\
     self->memory[index] = self->memory[--self->count];\
     return oldValue;\
+}\
+unsigned int type##ListRemoveIf(type##List * _Nonnull self, MELBoolean (* _Nonnull predicate)(type * _Nonnull element, void * _Nullable userdata), void * _Nullable userdata) {\
+    type *memory = self->memory;\
+    const unsigned int count = self->count;\
+    unsigned int kept = 0;\
+    for (unsigned int index = 0; index < count; index++) {\
+        if (!predicate(memory + index, userdata)) {\
+            if (kept != index) {\
+                memory[kept] = memory[index];\
+            }\
+            kept++;\
+        }\
+    }\
+    self->count = kept;\
+    return count - kept;\
+}\
+void type##ListSwap(type##List * _Nonnull self, unsigned int index, unsigned int otherIndex) {\
+    const type element = self->memory[index];\
+    self->memory[index] = self->memory[otherIndex];\
+    self->memory[otherIndex] = element;\
+}\
+void type##ListClear(type##List * _Nonnull self) {\
+    self->count = 0;\
 }
 
 #define MELListImplementIndexOf(type) \
@@ -248,6 +308,331 @@ int type##ListRemoveSwapEntry(type##List * _Nonnull self, type entry) {\
     return -1;\
 }
 
+#pragma mark - Sort
+
+/// Sous cette taille, les listes sont triées par insertion.
+#define MELListInsertionSortThreshold 16
+
+/// Converts a signed key to an unsigned key keeping its order, for type##ListRadixSort.
+#define MELListRadixKeyFromInt32(value) ((uint32_t) (int32_t) (value) ^ 0x80000000u)
+
+#define MELListDefineSort(type) \
+/** Sorts the list with an introsort: a quick sort falling back to a heap sort when it degenerates. Not stable. */\
+void type##ListSort(type##List * _Nonnull self, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs));\
+/** Index of the first element not ordered before value. The list must be sorted with the same comparator. */\
+unsigned int type##ListLowerBound(type##List self, const type * _Nonnull value, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs));\
+/** Index of the first element ordered after value. The list must be sorted with the same comparator. */\
+unsigned int type##ListUpperBound(type##List self, const type * _Nonnull value, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs));
+
+#define MELListDefineRadixSort(type) \
+/** Sorts the list by an unsigned 32 bits key, one byte at a time. Stable. Signed keys must go through MELListRadixKeyFromInt32. */\
+void type##ListRadixSort(type##List * _Nonnull self, uint32_t (* _Nonnull key)(const type * _Nonnull element));
+
+/**
+ * Sorted set: a list kept sorted by comparator, without duplicates.
+ * Lookups are binary searches. Requires MELListImplementSort(type).
+ */
+#define MELListDefineSortedSet(type) \
+/** Adds element at its place. Returns false if the list already contains an equal element. */\
+MELBoolean type##ListSortedSetAdd(type##List * _Nonnull self, type element);\
+int type##ListSortedSetIndexOf(type##List self, type element);\
+MELBoolean type##ListSortedSetContains(type##List self, type element);\
+MELBoolean type##ListSortedSetRemove(type##List * _Nonnull self, type element);
+
+#define MELListImplementSort(type) \
+void type##ListInsertionSort(type * _Nonnull memory, unsigned int count, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    for (unsigned int index = 1; index < count; index++) {\
+        const type element = memory[index];\
+        unsigned int hole = index;\
+        while (hole > 0 && comparator(&element, memory + hole - 1) < 0) {\
+            memory[hole] = memory[hole - 1];\
+            hole--;\
+        }\
+        memory[hole] = element;\
+    }\
+}\
+void type##ListSiftDown(type * _Nonnull memory, unsigned int root, unsigned int count, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    const type element = memory[root];\
+    unsigned int child = root * 2 + 1;\
+    while (child < count) {\
+        if (child + 1 < count && comparator(memory + child, memory + child + 1) < 0) {\
+            child++;\
+        }\
+        if (comparator(&element, memory + child) >= 0) {\
+            break;\
+        }\
+        memory[root] = memory[child];\
+        root = child;\
+        child = root * 2 + 1;\
+    }\
+    memory[root] = element;\
+}\
+void type##ListHeapSort(type * _Nonnull memory, unsigned int count, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    for (unsigned int index = count / 2; index > 0; index--) {\
+        type##ListSiftDown(memory, index - 1, count, comparator);\
+    }\
+    for (unsigned int end = count - 1; end > 0; end--) {\
+        const type swap = memory[0];\
+        memory[0] = memory[end];\
+        memory[end] = swap;\
+        type##ListSiftDown(memory, 0, end, comparator);\
+    }\
+}\
+void type##ListIntroSort(type * _Nonnull memory, unsigned int count, unsigned int depth, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    while (count > MELListInsertionSortThreshold) {\
+        if (depth == 0) {\
+            type##ListHeapSort(memory, count, comparator);\
+            return;\
+        }\
+        depth--;\
+        /* Médiane de trois : après ces échanges, le premier et le dernier élément servent de sentinelles. */\
+        const unsigned int middle = count / 2;\
+        const unsigned int last = count - 1;\
+        type swap;\
+        if (comparator(memory + middle, memory) < 0) {\
+            swap = memory[0];\
+            memory[0] = memory[middle];\
+            memory[middle] = swap;\
+        }\
+        if (comparator(memory + last, memory + middle) < 0) {\
+            swap = memory[middle];\
+            memory[middle] = memory[last];\
+            memory[last] = swap;\
+            if (comparator(memory + middle, memory) < 0) {\
+                swap = memory[0];\
+                memory[0] = memory[middle];\
+                memory[middle] = swap;\
+            }\
+        }\
+        const type pivot = memory[middle];\
+        unsigned int left = 0;\
+        unsigned int right = last;\
+        while (true) {\
+            do {\
+                left++;\
+            } while (comparator(memory + left, &pivot) < 0);\
+            do {\
+                right--;\
+            } while (comparator(&pivot, memory + right) < 0);\
+            if (left >= right) {\
+                break;\
+            }\
+            swap = memory[left];\
+            memory[left] = memory[right];\
+            memory[right] = swap;\
+        }\
+        /* Récursion sur la plus petite partie pour borner la pile. */\
+        const unsigned int leftCount = right + 1;\
+        const unsigned int rightCount = count - leftCount;\
+        if (leftCount < rightCount) {\
+            type##ListIntroSort(memory, leftCount, depth, comparator);\
+            memory += leftCount;\
+            count = rightCount;\
+        } else {\
+            type##ListIntroSort(memory + leftCount, rightCount, depth, comparator);\
+            count = leftCount;\
+        }\
+    }\
+    type##ListInsertionSort(memory, count, comparator);\
+}\
+void type##ListSort(type##List * _Nonnull self, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    const unsigned int count = self->count;\
+    if (count < 2) {\
+        return;\
+    }\
+    unsigned int depth = 0;\
+    for (unsigned int size = count; size > 1; size >>= 1) {\
+        depth += 2;\
+    }\
+    type##ListIntroSort(self->memory, count, depth, comparator);\
+}\
+unsigned int type##ListLowerBound(type##List self, const type * _Nonnull value, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    unsigned int low = 0;\
+    unsigned int high = self.count;\
+    while (low < high) {\
+        const unsigned int middle = low + (high - low) / 2;\
+        if (comparator(self.memory + middle, value) < 0) {\
+            low = middle + 1;\
+        } else {\
+            high = middle;\
+        }\
+    }\
+    return low;\
+}\
+unsigned int type##ListUpperBound(type##List self, const type * _Nonnull value, int (* _Nonnull comparator)(const type * _Nonnull lhs, const type * _Nonnull rhs)) {\
+    unsigned int low = 0;\
+    unsigned int high = self.count;\
+    while (low < high) {\
+        const unsigned int middle = low + (high - low) / 2;\
+        if (comparator(value, self.memory + middle) < 0) {\
+            high = middle;\
+        } else {\
+            low = middle + 1;\
+        }\
+    }\
+    return low;\
+}
+
+#define MELListImplementRadixSort(type) \
+void type##ListRadixSort(type##List * _Nonnull self, uint32_t (* _Nonnull key)(const type * _Nonnull element)) {\
+    const unsigned int count = self->count;\
+    if (count < 2) {\
+        return;\
+    }\
+    /* Un seul bloc pour la copie des éléments et les deux tableaux de clés, placés à la suite des éléments sur une adresse alignée. */\
+    const size_t keysOffset = (sizeof(type) * count + _Alignof(uint32_t) - 1) & ~(_Alignof(uint32_t) - 1);\
+    type *buffer = playdate->system->realloc(NULL, keysOffset + sizeof(uint32_t) * 2 * count);\
+    if (buffer == NULL) {\
+        playdate->system->error("Unable to allocate radix sort buffer for %u elements of type", count);\
+        return;\
+    }\
+    uint32_t *keys = (uint32_t *) ((uint8_t *) buffer + keysOffset);\
+    uint32_t *bufferKeys = keys + count;\
+    type *elements = self->memory;\
+    for (unsigned int index = 0; index < count; index++) {\
+        keys[index] = key(elements + index);\
+    }\
+    type *target = buffer;\
+    for (unsigned int shift = 0; shift < 32; shift += 8) {\
+        unsigned int offsets[256] = {};\
+        for (unsigned int index = 0; index < count; index++) {\
+            offsets[(keys[index] >> shift) & 0xFF]++;\
+        }\
+        if (offsets[(keys[0] >> shift) & 0xFF] == count) {\
+            /* Tous les éléments partagent cet octet : la passe ne changerait rien. */\
+            continue;\
+        }\
+        unsigned int offset = 0;\
+        for (unsigned int digit = 0; digit < 256; digit++) {\
+            const unsigned int digitCount = offsets[digit];\
+            offsets[digit] = offset;\
+            offset += digitCount;\
+        }\
+        for (unsigned int index = 0; index < count; index++) {\
+            const unsigned int position = offsets[(keys[index] >> shift) & 0xFF]++;\
+            target[position] = elements[index];\
+            bufferKeys[position] = keys[index];\
+        }\
+        type *swapElements = elements;\
+        elements = target;\
+        target = swapElements;\
+        uint32_t *swapKeys = keys;\
+        keys = bufferKeys;\
+        bufferKeys = swapKeys;\
+    }\
+    if (elements != self->memory) {\
+        memcpy(self->memory, elements, sizeof(type) * count);\
+    }\
+    playdate->system->realloc(buffer, 0);\
+}
+
+#define MELListImplementSortedSet(type, comparator) \
+MELBoolean type##ListSortedSetAdd(type##List * _Nonnull self, type element) {\
+    const unsigned int index = type##ListLowerBound(*self, &element, comparator);\
+    if (index < self->count && comparator(self->memory + index, &element) == 0) {\
+        return false;\
+    }\
+    type##ListInsert(self, index, element);\
+    return true;\
+}\
+int type##ListSortedSetIndexOf(type##List self, type element) {\
+    const unsigned int index = type##ListLowerBound(self, &element, comparator);\
+    return index < self.count && comparator(self.memory + index, &element) == 0\
+        ? (int) index\
+        : -1;\
+}\
+MELBoolean type##ListSortedSetContains(type##List self, type element) {\
+    return type##ListSortedSetIndexOf(self, element) >= 0;\
+}\
+MELBoolean type##ListSortedSetRemove(type##List * _Nonnull self, type element) {\
+    const int index = type##ListSortedSetIndexOf(*self, element);\
+    if (index < 0) {\
+        return false;\
+    }\
+    type##ListRemove(self, index);\
+    return true;\
+}
+
+#pragma mark - Small list
+
+/**
+ * Defines a list storing up to N elements inline, without any allocation.
+ * Elements are moved to the heap when the list grows beyond N.
+ *
+ * Elements must be accessed through type##SmallListMemory: the inline storage moves
+ * with the list when it is copied.
+ */
+#define MELSmallListDefine(type, N) /** List of type with N inline elements */ typedef struct melsmalllist_##type { \
+    /** Content of the list once it holds more than N elements, NULL before. */ \
+    type * _Nullable heap; \
+    /** Number of elements in the list. */ \
+    unsigned int count; \
+    /** Capacity of heap. */ \
+    unsigned int capacity; \
+    type inlineMemory[N]; \
+} type##SmallList;\
+\
+extern const type##SmallList type##SmallListEmpty;\
+type * _Nonnull type##SmallListMemory(type##SmallList * _Nonnull self);\
+void type##SmallListDeinit(type##SmallList * _Nonnull self);\
+void type##SmallListEnsureCapacity(type##SmallList * _Nonnull self, unsigned int required);\
+void type##SmallListPush(type##SmallList * _Nonnull self, type element);\
+type type##SmallListPop(type##SmallList * _Nonnull self);\
+type type##SmallListGet(const type##SmallList * _Nonnull self, unsigned int index);\
+type type##SmallListRemove(type##SmallList * _Nonnull self, unsigned int index);\
+type type##SmallListRemoveSwap(type##SmallList * _Nonnull self, unsigned int index);
+
+#define MELSmallListInlineCapacity(type) (sizeof(((type##SmallList *) NULL)->inlineMemory) / sizeof(type))
+
+#define MELSmallListImplement(type) const type##SmallList type##SmallListEmpty = {};\
+type * _Nonnull type##SmallListMemory(type##SmallList * _Nonnull self) {\
+    return self->heap != NULL ? self->heap : self->inlineMemory;\
+}\
+void type##SmallListDeinit(type##SmallList * _Nonnull self) {\
+    if (self->heap != NULL) {\
+        playdate->system->realloc(self->heap, 0);\
+        self->heap = NULL;\
+    }\
+    self->count = 0;\
+    self->capacity = 0;\
+}\
+void type##SmallListEnsureCapacity(type##SmallList * _Nonnull self, unsigned int required) {\
+    const unsigned int capacity = self->heap != NULL ? self->capacity : MELSmallListInlineCapacity(type);\
+    if (capacity >= required) {\
+        return;\
+    }\
+    const unsigned int newCapacity = capacity * 2 > required ? capacity * 2 : required;\
+    if (self->heap != NULL) {\
+        self->heap = playdate->system->realloc(self->heap, newCapacity * sizeof(type));\
+    } else {\
+        self->heap = playdate->system->realloc(NULL, newCapacity * sizeof(type));\
+        memcpy(self->heap, self->inlineMemory, self->count * sizeof(type));\
+    }\
+    self->capacity = newCapacity;\
+}\
+void type##SmallListPush(type##SmallList * _Nonnull self, type element) {\
+    type##SmallListEnsureCapacity(self, self->count + 1);\
+    type##SmallListMemory(self)[self->count++] = element;\
+}\
+type type##SmallListPop(type##SmallList * _Nonnull self) {\
+    return type##SmallListMemory(self)[--self->count];\
+}\
+type type##SmallListGet(const type##SmallList * _Nonnull self, unsigned int index) {\
+    return self->heap != NULL ? self->heap[index] : self->inlineMemory[index];\
+}\
+type type##SmallListRemove(type##SmallList * _Nonnull self, unsigned int index) {\
+    type *memory = type##SmallListMemory(self);\
+    const type oldValue = memory[index];\
+    memmove(memory + index, memory + index + 1, ((self->count--) - index - 1) * sizeof(type));\
+    return oldValue;\
+}\
+type type##SmallListRemoveSwap(type##SmallList * _Nonnull self, unsigned int index) {\
+    type *memory = type##SmallListMemory(self);\
+    const type oldValue = memory[index];\
+    memory[index] = memory[--self->count];\
+    return oldValue;\
+}
+
 #define MELListImplementSaveRef(type) \
 void type##RefListSave(type##RefList self, MELOutputStream * _Nonnull outputStream) {\
     MELOutputStreamWriteUInt32(outputStream, self.count);\
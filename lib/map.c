@@ -29,6 +29,8 @@ MELMap * _Nullable MELMapOpen(const char * _Nonnull path) {
     MELMap *self = playdate->system->realloc(NULL, sizeof(MELMap));
     MELMap map = {
         .tileSize = MELIntSizeMake(tileSize, tileSize),
+        .tileWidthDivider = MELIntDividerMake(tileSize),
+        .tileHeightDivider = MELIntDividerMake(tileSize),
         .grounds = MELLayerRefListEmpty,
         .instances = MELSpriteInstanceListEmpty
     };
@@ -94,6 +96,8 @@ void MELMapReadHeader(MELMap * _Nonnull self, MELInputStream * _Nonnull inputStr
 #endif
     MELMap map = {
         .tileSize = MELIntSizeMake(tileSize, tileSize),
+        .tileWidthDivider = MELIntDividerMake(tileSize),
+        .tileHeightDivider = MELIntDividerMake(tileSize),
         .grounds = MELLayerRefListEmpty,
         .instances = MELSpriteInstanceListEmpty
     };
@@ -13,6 +13,7 @@
 #include "layer.h"
 #include "spriteinstance.h"
 #include "rectangle.h"
+#include "divider.h"
 
 typedef float (* _Nonnull MELPaletteHitbox)(uint16_t tile, float x);
 
@@ -22,6 +23,10 @@ typedef struct melmap {
     // weak
     LCDBitmapTable * _Nullable palette;
     MELIntSize tileSize;
+    /// Division par `tileSize.width`, préparée au chargement de la carte.
+    MELIntDivider tileWidthDivider;
+    /// Division par `tileSize.height`, préparée au chargement de la carte.
+    MELIntDivider tileHeightDivider;
     MELPaletteHitbox xHitbox;
     MELPaletteHitbox yHitbox;
     MELIntRectangle water;
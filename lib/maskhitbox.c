@@ -0,0 +1,59 @@
+//
+//  maskhitbox.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "maskhitbox.h"
+
+#include "hitboxtype.h"
+#include "sprite.h"
+
+static MELRectangle getFrame(MELMaskHitbox * _Nonnull self) {
+    return self->sprite->frame;
+}
+
+static void save(MELHitbox * _Nonnull self, MELOutputStream * _Nonnull outputStream) {
+    MELOutputStreamWriteByte(outputStream, MELHitboxTypeMaskHitbox);
+}
+
+const MELHitboxClass MELMaskHitboxClass = {
+    .getFrame = (MELRectangle(*)(MELHitbox *)) &getFrame,
+    .save = save,
+};
+
+MELHitbox * _Nonnull MELMaskHitboxAlloc(MELSprite * _Nonnull sprite) {
+    MELMaskHitbox *self = malloc(sizeof(MELMaskHitbox));
+    *self = (MELMaskHitbox) {
+        .super = (MELHitbox) {
+            .class = &MELMaskHitboxClass
+        },
+        .sprite = sprite
+    };
+    return (MELHitbox *)self;
+}
+
+const MELBitmapMask * _Nullable MELMaskHitboxGetMask(MELMaskHitbox * _Nonnull self, MELIntPoint * _Nonnull topLeft) {
+    MELSprite *sprite = self->sprite;
+    if (sprite->animation == NULL || sprite->definition.palette == NULL) {
+        return NULL;
+    }
+    LCDBitmap *bitmap = playdate->graphics->getTableBitmap(sprite->definition.palette, sprite->animation->frame.atlasIndex);
+    if (bitmap == NULL) {
+        return NULL;
+    }
+    const LCDBitmapFlip flip = MELDirectionFlip[sprite->direction];
+    if (bitmap != self->maskBitmap || flip != self->maskFlip || self->mask == NULL) {
+        self->mask = MELBitmapMaskGet(bitmap, flip);
+        self->maskBitmap = bitmap;
+        self->maskFlip = flip;
+    }
+    const MELBitmapMask *mask = self->mask;
+    const MELPoint origin = sprite->frame.origin;
+    *topLeft = (MELIntPoint) {
+        .x = (int) floorf(origin.x - mask->width / 2.0f),
+        .y = (int) floorf(origin.y - mask->height / 2.0f),
+    };
+    return mask;
+}
@@ -0,0 +1,43 @@
+//
+//  maskhitbox.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef maskhitbox_h
+#define maskhitbox_h
+
+#include "hitbox.h"
+#include "bitmapmask.h"
+
+extern const MELHitboxClass MELMaskHitboxClass;
+
+typedef struct melsprite MELSprite;
+
+/**
+ * Hitbox au pixel près, basée sur le masque de l'image actuelle du sprite.
+ * Son cadre est celui du sprite : les tests de collision commencent par comparer les rectangles
+ * et ne lisent les masques que si les rectangles se touchent.
+ */
+typedef struct {
+    MELHitbox super;
+    MELSprite * _Nonnull sprite;
+    /// Dernier masque utilisé, pour éviter de chercher à nouveau le masque tant que l'image ne change pas.
+    const MELBitmapMask * _Nullable mask;
+    LCDBitmap * _Nullable maskBitmap;
+    LCDBitmapFlip maskFlip;
+} MELMaskHitbox;
+
+MELHitbox * _Nonnull MELMaskHitboxAlloc(MELSprite * _Nonnull sprite);
+
+/**
+ * Retourne le masque de l'image actuelle du sprite.
+ *
+ * @param self Hitbox.
+ * @param topLeft Reçoit la position du coin haut gauche du masque dans le monde.
+ * @return Le masque ou NULL si le sprite n'a pas d'image.
+ */
+const MELBitmapMask * _Nullable MELMaskHitboxGetMask(MELMaskHitbox * _Nonnull self, MELIntPoint * _Nonnull topLeft);
+
+#endif /* maskhitbox_h */
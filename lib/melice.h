@@ -29,6 +29,10 @@
 #include "axe.h"
 #include "direction.h"
 #include "geomap.h"
+#include "collisionworld.h"
+#include "spritebatch.h"
+#include "spriteculling.h"
+#include "particlesystem.h"
 #include "sprite.h"
 #include "spriteinstance.h"
 #include "spritetype.h"
@@ -48,8 +52,14 @@
 #include "statichitbox.h"
 #include "spritehitbox.h"
 #include "simplespritehitbox.h"
+#include "maskhitbox.h"
+#include "orientedhitbox.h"
+#include "capsulehitbox.h"
+#include "bitmapmask.h"
 #include "shootingstyle.h"
 #include "shootingstyledefinition.h"
+#include "bulletpattern.h"
+#include "bulletmotion.h"
 #include "bullet.h"
 #include "burstshootingstyle.h"
 #include "circularshootingstyle.h"
@@ -77,9 +87,15 @@
 #include "keyvaluetable.h"
 #include "language.h"
 #include "list.h"
+#include "slotmap.h"
 #include "lcdspriteref.h"
 #include "melmath.h"
+#include "trigtable.h"
+#include "easingtable.h"
+#include "fixed.h"
+#include "divider.h"
 #include "melstring.h"
+#include "atom.h"
 #include "metadata.h"
 #include "operation.h"
 #include "random.h"
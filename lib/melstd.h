@@ -11,6 +11,10 @@
 #define MELSPRITEINSTANCE_IGNORE_ANIMATION_NAME 0
 #define MELMAP_IGNORE_TILESIZE 0
 #define MELSCREEN_ORIENTATION_VERTICAL 0
+#define MELFIXED_COORDINATES 0
+#define MELTRIGTABLE_USE_LIBM 0
+#define MELTRIGTABLE_SIZE 256
+#define MELLIST_GROWTH_PERCENT 150
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -10,6 +10,10 @@
 #include <string.h>
 #include "melmath.h"
 
+/// En dessous de ces tailles, la table de Horspool coûte plus cher qu'elle ne fait gagner.
+#define kHorspoolMinimumLength 256
+#define kHorspoolMinimumNeedleLength 8
+
 MELListImplement(MELChar);
 MELListImplement(MELChar16);
 MELListImplement(MELCodePoint);
@@ -24,12 +28,13 @@ MELBoolean MELStringEquals(const char * _Nonnull lhs, const char * _Nonnull rhs)
     return !strcmp(lhs, rhs);
 }
 MELBoolean MELStringStartsWith(const char * _Nonnull lhs, const char * _Nonnull rhs) {
-    const unsigned int lhsLength = (unsigned int) strlen(lhs);
-    const unsigned int rhsLength = (unsigned int) strlen(rhs);
-    if (lhsLength < rhsLength) {
-        return false;
+    // Une seule passe : inutile de mesurer lhs, la comparaison s'arrête à la fin de l'un des deux.
+    while (*rhs != '\0') {
+        if (*lhs++ != *rhs++) {
+            return false;
+        }
     }
-    return !strncmp(lhs, rhs, rhsLength);
+    return true;
 }
 MELBoolean MELStringEndsWith(const char * _Nonnull lhs, const char * _Nonnull rhs) {
     const unsigned int lhsLength = (unsigned int) strlen(lhs);
@@ -41,13 +46,57 @@ MELBoolean MELStringEndsWith(const char * _Nonnull lhs, const char * _Nonnull rh
 }
 
 uint32_t MELStringHash(const char * _Nullable key) {
-    if (key == NULL || *key == '\0') {
+    if (key == NULL) {
         return 0;
     }
-    uint32_t hash = 5381;
-    for (uint32_t index = 0; key[index]; index++) {
-        hash = ((hash << 5) + hash) ^ key[index];
+    return MELStringHashWithLength(key, (unsigned int) strlen(key));
+}
+
+static uint32_t rotateLeft(uint32_t value, unsigned int count) {
+    return (value << count) | (value >> (32 - count));
+}
+
+uint32_t MELStringHashWithLength(const char * _Nullable key, unsigned int length) {
+    if (key == NULL || length == 0) {
+        return 0;
     }
+    // MurmurHash3 (x86, 32 bits) : la chaîne est lue 4 octets à la fois.
+    const uint32_t c1 = 0xcc9e2d51;
+    const uint32_t c2 = 0x1b873593;
+    uint32_t hash = 0x9747b28c;
+    const unsigned int blockCount = length / 4;
+    for (unsigned int index = 0; index < blockCount; index++) {
+        uint32_t block;
+        memcpy(&block, key + index * 4, sizeof(uint32_t));
+        block *= c1;
+        block = rotateLeft(block, 15);
+        block *= c2;
+        hash ^= block;
+        hash = rotateLeft(hash, 13);
+        hash = hash * 5 + 0xe6546b64;
+    }
+    const uint8_t *tail = (const uint8_t *) key + blockCount * 4;
+    uint32_t block = 0;
+    switch (length & 3) {
+        case 3:
+            block ^= tail[2] << 16;
+            // fallthrough
+        case 2:
+            block ^= tail[1] << 8;
+            // fallthrough
+        case 1:
+            block ^= tail[0];
+            block *= c1;
+            block = rotateLeft(block, 15);
+            block *= c2;
+            hash ^= block;
+    }
+    hash ^= length;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
     return hash;
 }
 
@@ -190,9 +239,13 @@ char * _Nullable MELUTF8StringMakeWithUTF16String(const uint16_t * _Nullable sou
     if (source == NULL) {
         return NULL;
     }
-    MELCodePointList codePoints = MELCodePointListMakeWithUTF16String(source);
-    char *utf8String = MELUTF8StringMakeWithCodePoints(codePoints);
-    MELCodePointListDeinit(&codePoints);
+    unsigned int sourceLength = 0;
+    while (source[sourceLength]) {
+        sourceLength++;
+    }
+    const unsigned int length = MELUTF8StringMakeWithUTF16StringAndBuffer(source, sourceLength, NULL, 0);
+    char *utf8String = playdate->system->realloc(NULL, length + 1);
+    MELUTF8StringMakeWithUTF16StringAndBuffer(source, sourceLength, utf8String, length + 1);
     return utf8String;
 }
 
@@ -274,12 +327,223 @@ uint16_t * _Nullable MELUTF16StringMakeWithUTF8String(const char * _Nullable sou
     if (source == NULL) {
         return NULL;
     }
-    MELCodePointList codePoints = MELCodePointListMakeWithUTF8String(source);
-    uint16_t *utf16String = MELUTF16StringMakeWithCodePoints(codePoints);
-    MELCodePointListDeinit(&codePoints);
+    const unsigned int sourceLength = (unsigned int) strlen(source);
+    const unsigned int length = MELUTF16StringMakeWithUTF8StringAndBuffer(source, sourceLength, NULL, 0);
+    uint16_t *utf16String = playdate->system->realloc(NULL, sizeof(uint16_t) * (length + 1));
+    MELUTF16StringMakeWithUTF8StringAndBuffer(source, sourceLength, utf16String, length + 1);
     return utf16String;
 }
 
+/// Lit le point de code commençant à `*index` et avance `*index` jusqu'au suivant. Même tolérance que `MELCodePointListMakeWithUTF8StringAndBuffer`.
+static MELCodePoint decodeUTF8(const char * _Nonnull source, unsigned int length, unsigned int * _Nonnull index) {
+    const unsigned int start = *index;
+    const uint32_t entry = source[start] & 0xFF;
+    const unsigned int remaining = length - start - 1;
+    if (entry <= 127) {
+        // ASCII
+        *index = start + 1;
+        return entry;
+    } else if (entry >> 5 == 6 && remaining >= 1 && isUTF8Wagon(source, start + 1)) {
+        // 2 bytes
+        *index = start + 2;
+        return ((entry & 31) << 6) | (source[start + 1] & 63);
+    } else if (entry >> 4 == 14 && remaining >= 2 && isTrailedByCountUTF8Wagon(source, start, 2)) {
+        // 3 bytes
+        *index = start + 3;
+        return ((entry & 15) << 12) | ((source[start + 1] & 63) << 6) | (source[start + 2] & 63);
+    } else if (entry >> 3 == 30 && remaining >= 3 && isTrailedByCountUTF8Wagon(source, start, 3)) {
+        // 4 bytes
+        *index = start + 4;
+        return ((entry & 7) << 18) | ((source[start + 1] & 63) << 12) | ((source[start + 2] & 63) << 6) | (source[start + 3] & 63);
+    }
+    // Encoding error
+    *index = start + 1;
+    return 0xFFFD;
+}
+
+unsigned int MELUTF16StringMakeWithUTF8StringAndBuffer(const char * _Nonnull source, unsigned int length, MELChar16 * _Nullable buffer, unsigned int capacity) {
+    const unsigned int limit = buffer != NULL && capacity > 0 ? capacity - 1 : 0;
+    // count : taille de la chaîne complète, written : taille écrite. L'écriture s'arrête au premier caractère qui ne rentre pas.
+    unsigned int count = 0;
+    unsigned int written = 0;
+    unsigned int index = 0;
+    while (index < length) {
+        if (index + 4 <= length) {
+            uint32_t word;
+            memcpy(&word, source + index, sizeof(uint32_t));
+            if ((word & 0x80808080) == 0) {
+                if (written != count) {
+                    count += 4;
+                    index += 4;
+                    continue;
+                } else if (count + 4 <= limit) {
+                    buffer[count] = source[index];
+                    buffer[count + 1] = source[index + 1];
+                    buffer[count + 2] = source[index + 2];
+                    buffer[count + 3] = source[index + 3];
+                    count += 4;
+                    written = count;
+                    index += 4;
+                    continue;
+                }
+            }
+        }
+        const MELCodePoint codePoint = decodeUTF8(source, length, &index);
+        MELChar16 units[2];
+        unsigned int unitCount = 1;
+        if (codePoint <= 0xD7FF || (codePoint >= 0xE000 && codePoint <= 0xFFFF)) {
+            // Basic Multilingual Plane
+            units[0] = codePoint;
+        } else if (codePoint >= 0x010000 && codePoint <= 0x10FFFF) {
+            // Supplementary Planes
+            const MELCodePoint valueToEncode = codePoint - 0x010000;
+            units[0] = (valueToEncode >> 10) | 0xD800;
+            units[1] = (valueToEncode & 0x3FF) | 0xDC00;
+            unitCount = 2;
+        } else {
+            // Encoding error
+            units[0] = 0xFFFD;
+        }
+        if (written == count && count + unitCount <= limit) {
+            buffer[count] = units[0];
+            if (unitCount == 2) {
+                buffer[count + 1] = units[1];
+            }
+            written += unitCount;
+        }
+        count += unitCount;
+    }
+    if (buffer != NULL && capacity > 0) {
+        buffer[written] = 0;
+    }
+    return count;
+}
+
+unsigned int MELUTF8StringMakeWithUTF16StringAndBuffer(const MELChar16 * _Nonnull source, unsigned int length, char * _Nullable buffer, unsigned int capacity) {
+    const unsigned int limit = buffer != NULL && capacity > 0 ? capacity - 1 : 0;
+    unsigned int count = 0;
+    unsigned int written = 0;
+    unsigned int index = 0;
+    while (index < length) {
+        if (index + 4 <= length && (source[index] | source[index + 1] | source[index + 2] | source[index + 3]) < 0x80) {
+            if (written != count) {
+                count += 4;
+                index += 4;
+                continue;
+            } else if (count + 4 <= limit) {
+                buffer[count] = source[index];
+                buffer[count + 1] = source[index + 1];
+                buffer[count + 2] = source[index + 2];
+                buffer[count + 3] = source[index + 3];
+                count += 4;
+                written = count;
+                index += 4;
+                continue;
+            }
+        }
+        const MELChar16 entry = source[index];
+        const MELChar16 nextEntry = index + 1 < length ? source[index + 1] : 0;
+        MELCodePoint codePoint;
+        if (entry <= 0xD7FF || entry >= 0xE000) {
+            // Basic Multilingual Plane
+            codePoint = entry;
+            index++;
+        } else if ((entry >= 0xD800 && entry <= 0xDBFF) && (nextEntry >= 0xDC00 && nextEntry <= 0xDFFF)) {
+            // High surrogate - low surrogate
+            codePoint = (entry & 0x3FF) << 10 | (nextEntry & 0x3FF) | 0x10000;
+            index += 2;
+        } else if ((entry >= 0xDC00 && entry <= 0xDFFF) && (nextEntry >= 0xD800 && nextEntry <= 0xDBFF)) {
+            // Low surrogate - high surrogate
+            codePoint = (nextEntry & 0x3FF) << 10 | (entry & 0x3FF) | 0x10000;
+            index += 2;
+        } else {
+            // Encoding error
+            codePoint = 0xFFFD;
+            index++;
+        }
+        char bytes[4];
+        unsigned int byteCount;
+        if (codePoint <= 0x007F) {
+            bytes[0] = codePoint;
+            byteCount = 1;
+        } else if (codePoint <= 0x07FF) {
+            bytes[0] = (codePoint >> 6) | 192;
+            bytes[1] = (codePoint & 63) | 128;
+            byteCount = 2;
+        } else if (codePoint <= 0xFFFF) {
+            bytes[0] = (codePoint >> 12) | 224;
+            bytes[1] = ((codePoint >> 6) & 63) | 128;
+            bytes[2] = (codePoint & 63) | 128;
+            byteCount = 3;
+        } else {
+            bytes[0] = (codePoint >> 18) | 240;
+            bytes[1] = ((codePoint >> 12) & 63) | 128;
+            bytes[2] = ((codePoint >> 6) & 63) | 128;
+            bytes[3] = (codePoint & 63) | 128;
+            byteCount = 4;
+        }
+        if (written == count && count + byteCount <= limit) {
+            memcpy(buffer + count, bytes, byteCount);
+            written += byteCount;
+        }
+        count += byteCount;
+    }
+    if (buffer != NULL && capacity > 0) {
+        buffer[written] = '\0';
+    }
+    return count;
+}
+
+const MELUTF8Decoder MELUTF8DecoderEmpty = {};
+
+unsigned int MELUTF8DecoderPush(MELUTF8Decoder * _Nonnull self, char character, MELCodePoint * _Nonnull codePoints) {
+    const uint32_t entry = character & 0xFF;
+    unsigned int count = 0;
+    if (self->remaining > 0) {
+        if (entry >> 6 == 2) {
+            self->codePoint = (self->codePoint << 6) | (entry & 63);
+            if (--self->remaining > 0) {
+                return 0;
+            }
+            codePoints[0] = self->codePoint;
+            return 1;
+        }
+        // Séquence interrompue : l'octet courant est décodé normalement.
+        self->remaining = 0;
+        codePoints[count++] = 0xFFFD;
+    }
+    if (entry <= 127) {
+        // ASCII
+        codePoints[count++] = entry;
+    } else if (entry >> 5 == 6) {
+        // 2 bytes
+        self->codePoint = entry & 31;
+        self->remaining = 1;
+    } else if (entry >> 4 == 14) {
+        // 3 bytes
+        self->codePoint = entry & 15;
+        self->remaining = 2;
+    } else if (entry >> 3 == 30) {
+        // 4 bytes
+        self->codePoint = entry & 7;
+        self->remaining = 3;
+    } else {
+        // Encoding error
+        codePoints[count++] = 0xFFFD;
+    }
+    return count;
+}
+
+unsigned int MELUTF8DecoderFinish(MELUTF8Decoder * _Nonnull self, MELCodePoint * _Nonnull codePoint) {
+    const MELBoolean isIncomplete = self->remaining > 0;
+    *self = MELUTF8DecoderEmpty;
+    if (isIncomplete) {
+        *codePoint = 0xFFFD;
+        return 1;
+    }
+    return 0;
+}
+
 unsigned int MELStringLengthToDisplayUInt(unsigned int value) {
     return value == 0
         ? 1
@@ -457,6 +721,11 @@ int MELStringLastIndexOfCharacter(const char * _Nonnull haystack, char needle) {
     return pos == NULL ? -1 : (int) (pos - haystack);
 }
 
+int MELStringIndexOfCharacterWithLength(const char * _Nonnull haystack, unsigned int length, char needle) {
+    const char *pos = memchr(haystack, needle, length);
+    return pos == NULL ? -1 : (int) (pos - haystack);
+}
+
 int MELStringIndexOfString(const char * _Nonnull haystack, const char * _Nonnull needle) {
     const char *position = strstr(haystack, needle);
     if (position == NULL) {
@@ -465,3 +734,50 @@ int MELStringIndexOfString(const char * _Nonnull haystack, const char * _Nonnull
         return (int) (position - haystack);
     }
 }
+
+int MELStringIndexOfStringWithLength(const char * _Nonnull haystack, unsigned int haystackLength, const char * _Nonnull needle, unsigned int needleLength) {
+    if (needleLength == 0) {
+        return 0;
+    } else if (needleLength > haystackLength) {
+        return -1;
+    } else if (needleLength == 1) {
+        return MELStringIndexOfCharacterWithLength(haystack, haystackLength, needle[0]);
+    }
+    const unsigned int lastStart = haystackLength - needleLength;
+    if (haystackLength < kHorspoolMinimumLength || needleLength < kHorspoolMinimumNeedleLength) {
+        // memchr trouve les candidats, memcmp vérifie la suite.
+        const char first = needle[0];
+        unsigned int start = 0;
+        while (start <= lastStart) {
+            const char *candidate = memchr(haystack + start, first, lastStart - start + 1);
+            if (candidate == NULL) {
+                return -1;
+            }
+            start = (unsigned int) (candidate - haystack);
+            if (!memcmp(candidate + 1, needle + 1, needleLength - 1)) {
+                return (int) start;
+            }
+            start++;
+        }
+        return -1;
+    }
+    // Boyer-Moore-Horspool : le dernier caractère de la fenêtre donne le décalage.
+    unsigned int shifts[256];
+    for (unsigned int index = 0; index < 256; index++) {
+        shifts[index] = needleLength;
+    }
+    const unsigned int lastIndex = needleLength - 1;
+    for (unsigned int index = 0; index < lastIndex; index++) {
+        shifts[(uint8_t) needle[index]] = lastIndex - index;
+    }
+    const char last = needle[lastIndex];
+    unsigned int start = 0;
+    while (start <= lastStart) {
+        const char character = haystack[start + lastIndex];
+        if (character == last && !memcmp(haystack + start, needle, lastIndex)) {
+            return (int) start;
+        }
+        start += shifts[(uint8_t) character];
+    }
+    return -1;
+}
@@ -30,6 +30,11 @@ MELBoolean MELStringStartsWith(const char * _Nonnull lhs, const char * _Nonnull
 MELBoolean MELStringEndsWith(const char * _Nonnull lhs, const char * _Nonnull rhs);
 
 uint32_t MELStringHash(const char * _Nullable key);
+/**
+ * Calcule le hash des `length` premiers caractères de la chaîne donnée, 4 octets à la fois.
+ * `MELStringHash(key)` vaut `MELStringHashWithLength(key, strlen(key))`.
+ */
+uint32_t MELStringHashWithLength(const char * _Nullable key, unsigned int length);
 
 char * _Nullable MELStringCopy(const char * restrict _Nullable source);
 char * _Nonnull MELStringConcat(const char * _Nullable lhs, const char * _Nullable rhs);
@@ -47,6 +52,63 @@ int MELUTF8StringCharacterSize(const char * _Nullable source, int index);
 uint16_t * _Nullable MELUTF16StringMakeWithCodePoints(MELCodePointList codePoints);
 uint16_t * _Nullable MELUTF16StringMakeWithUTF8String(const char * _Nullable source);
 
+/**
+ * Convertit une chaîne UTF-8 en UTF-16 dans le buffer donné, sans allocation.
+ * Les suites de caractères ASCII sont converties 4 par 4.
+ *
+ * Comme `snprintf`, le résultat est tronqué si le buffer est trop petit, sans jamais couper un caractère,
+ * et toujours terminé par un zéro si `capacity` est supérieure à 0.
+ *
+ * @param source Chaîne à convertir.
+ * @param length Nombre d'octets de `source` à convertir.
+ * @param buffer Buffer de destination ou NULL pour seulement calculer la taille nécessaire.
+ * @param capacity Nombre de `MELChar16` disponibles dans `buffer`, zéro final compris.
+ * @returns Le nombre de `MELChar16` de la chaîne convertie complète, sans le zéro final.
+ * La conversion est complète si cette valeur est inférieure à `capacity`.
+ */
+unsigned int MELUTF16StringMakeWithUTF8StringAndBuffer(const char * _Nonnull source, unsigned int length, MELChar16 * _Nullable buffer, unsigned int capacity);
+
+/**
+ * Convertit une chaîne UTF-16 en UTF-8 dans le buffer donné, sans allocation.
+ * Fonctionne comme `MELUTF16StringMakeWithUTF8StringAndBuffer`.
+ *
+ * @param length Nombre de `MELChar16` de `source` à convertir.
+ * @param capacity Nombre d'octets disponibles dans `buffer`, zéro final compris.
+ * @returns Le nombre d'octets de la chaîne convertie complète, sans le zéro final.
+ */
+unsigned int MELUTF8StringMakeWithUTF16StringAndBuffer(const MELChar16 * _Nonnull source, unsigned int length, char * _Nullable buffer, unsigned int capacity);
+
+/// Nombre maximal de points de code renvoyés par `MELUTF8DecoderPush`.
+#define MELUTF8DecoderMaximumCodePointCount 2
+
+/**
+ * Décodeur UTF-8 recevant le texte octet par octet, par exemple depuis un flux ou le port série.
+ * Une séquence interrompue donne un seul 0xFFFD.
+ */
+typedef struct {
+    /// Bits déjà lus du point de code en cours.
+    MELCodePoint codePoint;
+    /// Nombre d'octets manquants pour terminer le point de code en cours.
+    uint8_t remaining;
+} MELUTF8Decoder;
+
+extern const MELUTF8Decoder MELUTF8DecoderEmpty;
+
+/**
+ * Ajoute un octet au décodeur.
+ *
+ * @param codePoints Tableau d'au moins `MELUTF8DecoderMaximumCodePointCount` éléments recevant les points de code terminés.
+ * @returns Le nombre de points de code écrits dans `codePoints`.
+ */
+unsigned int MELUTF8DecoderPush(MELUTF8Decoder * _Nonnull self, char character, MELCodePoint * _Nonnull codePoints);
+
+/**
+ * Termine le décodage et réinitialise le décodeur.
+ *
+ * @returns 1 et écrit 0xFFFD dans `codePoint` si une séquence était incomplète, 0 sinon.
+ */
+unsigned int MELUTF8DecoderFinish(MELUTF8Decoder * _Nonnull self, MELCodePoint * _Nonnull codePoint);
+
 /**
  * Calcul le nombre de chiffres dans la valeur donnée.
  *
@@ -83,10 +145,18 @@ uint32_t MELStringToUInt32(const char * _Nonnull string);
 
 int MELStringIndexOfCharacter(const char * _Nonnull haystack, char needle);
 int MELStringLastIndexOfCharacter(const char * _Nonnull haystack, char needle);
+int MELStringIndexOfCharacterWithLength(const char * _Nonnull haystack, unsigned int length, char needle);
 
 #define MELStringParseInt(source) atoi(source)
 #define MELStringParseFloat(source) strtof(source, NULL)
 
 int MELStringIndexOfString(const char * _Nonnull haystack, const char * _Nonnull needle);
+/**
+ * Cherche needle dans haystack sans lire au-delà des longueurs données.
+ * Les textes longs sont parcourus avec l'algorithme de Boyer-Moore-Horspool.
+ *
+ * @return L'index de la première occurrence ou -1.
+ */
+int MELStringIndexOfStringWithLength(const char * _Nonnull haystack, unsigned int haystackLength, const char * _Nonnull needle, unsigned int needleLength);
 
 #endif /* melstring_h */
@@ -0,0 +1,93 @@
+//
+//  orientedhitbox.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "orientedhitbox.h"
+
+#include "hitboxtype.h"
+#include "sprite.h"
+
+static MELRectangle getFrame(MELOrientedHitbox * _Nonnull self) {
+    MELPoint axes[2];
+    const MELQuadrilateral quadrilateral = MELOrientedHitboxGetQuadrilateral(self, axes);
+    const MELRectangle enclosingRectangle = MELQuadrilateralGetEnclosingRectangle(quadrilateral);
+    return (MELRectangle) {
+        .origin = {
+            .x = enclosingRectangle.origin.x + enclosingRectangle.size.width / 2,
+            .y = enclosingRectangle.origin.y + enclosingRectangle.size.height / 2,
+        },
+        .size = enclosingRectangle.size
+    };
+}
+
+static void save(MELOrientedHitbox * _Nonnull self, MELOutputStream * _Nonnull outputStream) {
+    MELOutputStreamWriteByte(outputStream, MELHitboxTypeOrientedHitbox);
+    MELOutputStreamWriteBoolean(outputStream, self->sprite != NULL);
+    MELOutputStreamWriteRectangle(outputStream, self->frame);
+    MELOutputStreamWriteFloat(outputStream, self->rotation);
+}
+
+const MELHitboxClass MELOrientedHitboxClass = {
+    .getFrame = (MELRectangle(*)(MELHitbox *)) getFrame,
+    .save = (void(*)(MELHitbox *, MELOutputStream *)) save,
+};
+
+MELHitbox * _Nonnull MELOrientedHitboxAlloc(MELSprite * _Nullable sprite, MELRectangle frame, float rotation) {
+    MELOrientedHitbox *self = malloc(sizeof(MELOrientedHitbox));
+    *self = (MELOrientedHitbox) {
+        .super = (MELHitbox) {
+            .class = &MELOrientedHitboxClass
+        },
+        .sprite = sprite,
+        .frame = frame,
+        .rotation = rotation,
+        .axesRotation = rotation,
+        .axes = {
+            {cosf(rotation), sinf(rotation)},
+            {-sinf(rotation), cosf(rotation)},
+        },
+    };
+    return (MELHitbox *)self;
+}
+
+MELHitbox * _Nonnull MELOrientedHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite) {
+    const MELBoolean isAttachedToSprite = MELInputStreamReadBoolean(inputStream);
+    const MELRectangle frame = MELInputStreamReadRectangle(inputStream);
+    const float rotation = MELInputStreamReadFloat(inputStream);
+    return MELOrientedHitboxAlloc(isAttachedToSprite ? sprite : NULL, frame, rotation);
+}
+
+void MELOrientedHitboxSetRotation(MELOrientedHitbox * _Nonnull self, float rotation) {
+    self->rotation = rotation;
+    MELHitboxInvalidate(&self->super);
+}
+
+MELQuadrilateral MELOrientedHitboxGetQuadrilateral(MELOrientedHitbox * _Nonnull self, MELPoint * _Nonnull axes) {
+    const float rotation = self->rotation;
+    if (rotation != self->axesRotation) {
+        // Le cosinus et le sinus ne sont recalculés que si l'angle change.
+        const float cosine = cosf(rotation);
+        const float sine = sinf(rotation);
+        self->axes[0] = MELPointMake(cosine, sine);
+        self->axes[1] = MELPointMake(-sine, cosine);
+        self->axesRotation = rotation;
+    }
+    axes[0] = self->axes[0];
+    axes[1] = self->axes[1];
+
+    MELPoint center = self->frame.origin;
+    const MELSprite *sprite = self->sprite;
+    if (sprite != NULL) {
+        const float direction = MELDirectionValues[sprite->direction];
+        center = MELPointMake(sprite->frame.origin.x + center.x * direction, sprite->frame.origin.y + center.y);
+        if (direction < 0) {
+            // Retourner horizontalement un rectangle tourné de a revient à le tourner de -a.
+            axes[0].y = -axes[0].y;
+            axes[1].x = -axes[1].x;
+        }
+    }
+    return MELQuadrilateralMakeWithCenterSizeAndAxes(center, self->frame.size, axes);
+}
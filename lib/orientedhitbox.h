@@ -0,0 +1,49 @@
+//
+//  orientedhitbox.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef orientedhitbox_h
+#define orientedhitbox_h
+
+#include "hitbox.h"
+#include "quadrilateral.h"
+
+extern const MELHitboxClass MELOrientedHitboxClass;
+
+typedef struct melsprite MELSprite;
+
+/**
+ * Rectangle tourné autour de son centre.
+ *
+ * Si `sprite` est défini, le centre de `frame` est relatif à l'origine du sprite et la hitbox est retournée
+ * horizontalement lorsque le sprite regarde vers la gauche. Sinon, `frame` est en coordonnées du monde.
+ */
+typedef struct {
+    MELHitbox super;
+    MELSprite * _Nullable sprite;
+    MELRectangle frame;
+    float rotation;
+    /// Angle pour lequel `axes` a été calculé.
+    float axesRotation;
+    /// Cosinus et sinus de `rotation` pour le premier axe, (-sinus, cosinus) pour le second.
+    MELPoint axes[2];
+} MELOrientedHitbox;
+
+MELHitbox * _Nonnull MELOrientedHitboxAlloc(MELSprite * _Nullable sprite, MELRectangle frame, float rotation);
+MELHitbox * _Nonnull MELOrientedHitboxLoad(MELInputStream * _Nonnull inputStream, MELSprite * _Nonnull sprite);
+
+void MELOrientedHitboxSetRotation(MELOrientedHitbox * _Nonnull self, float rotation);
+
+/**
+ * Retourne le rectangle tourné en coordonnées du monde.
+ *
+ * @param self Hitbox.
+ * @param axes Reçoit les 2 axes du rectangle tourné, utilisables avec `MELQuadrilateralIntersectsQuadrilateralOnAxes`.
+ * @return Les 4 coins du rectangle tourné.
+ */
+MELQuadrilateral MELOrientedHitboxGetQuadrilateral(MELOrientedHitbox * _Nonnull self, MELPoint * _Nonnull axes);
+
+#endif /* orientedhitbox_h */
@@ -10,6 +10,8 @@
 #include "melstring.h"
 
 #define MELOutputStreamBufferSize 4096
+/// Les chaînes plus courtes sont converties en UTF-16 sur la pile.
+#define MELOutputStreamStringStackCapacity 128
 
 MELOutputStream MELOutputStreamOpen(const char * _Nonnull path) {
     return (MELOutputStream) {
@@ -194,14 +196,22 @@ unsigned int str16len(uint16_t * _Nonnull array) {
 }
 
 void MELOutputStreamWriteString(MELOutputStream * _Nonnull self, const char * _Nonnull value) {
-    uint16_t *utf16String = MELUTF16StringMakeWithUTF8String(value);
-    unsigned int count = str16len(utf16String);
+    const unsigned int length = (unsigned int) strlen(value);
+    MELChar16 stackString[MELOutputStreamStringStackCapacity];
+    MELChar16 *utf16String = stackString;
+    const unsigned int count = MELUTF16StringMakeWithUTF8StringAndBuffer(value, length, stackString, MELOutputStreamStringStackCapacity);
+    if (count >= MELOutputStreamStringStackCapacity) {
+        utf16String = playdate->system->realloc(NULL, sizeof(MELChar16) * (count + 1));
+        MELUTF16StringMakeWithUTF8StringAndBuffer(value, length, utf16String, count + 1);
+    }
 
     MELOutputStreamWriteInt(self, (int32_t) count);
     for (unsigned int index = 0; index < count; index++) {
         MELOutputStreamWriteUInt16(self, utf16String[index]);
     }
-    playdate->system->realloc(utf16String, 0);
+    if (utf16String != stackString) {
+        playdate->system->realloc(utf16String, 0);
+    }
 }
 
 void MELOutputStreamWriteNullableString(MELOutputStream * _Nonnull self, const char * _Nullable value) {
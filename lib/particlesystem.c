@@ -0,0 +1,360 @@
+//
+//  particlesystem.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "particlesystem.h"
+
+#include <limits.h>
+
+#include "melmath.h"
+#include "random.h"
+#include "sprite.h"
+#include "trigtable.h"
+#include "../src/common.h"
+
+#define MAX_KIND_COUNT 256
+
+MELListImplement(MELParticleKind);
+
+/// Systèmes de particules alloués, chaînés par `next`.
+static MELParticleSystem * _Nullable systems;
+
+static void update(LCDSprite * _Nonnull sprite);
+static void draw(LCDSprite * _Nonnull sprite, PDRect bounds, PDRect drawrect);
+static int kindIndexForAnimation(MELParticleSystem * _Nonnull self, MELSpriteDefinition * _Nonnull definition, const MELAnimationDefinition * _Nonnull animation);
+static void push(MELParticleSystem * _Nonnull self, float x, float y, float speedX, float speedY, MELTimeInterval lifetime, uint8_t kind);
+static void removeParticle(MELParticleSystem * _Nonnull self, unsigned int index);
+static LCDRect boundsOfParticles(MELParticleSystem * _Nonnull self, unsigned int start);
+static LCDRect rectUnion(LCDRect lhs, LCDRect rhs);
+static void addDirtyRect(LCDRect rect);
+
+MELParticleSystem * _Nonnull MELParticleSystemAlloc(unsigned int capacity, int16_t zIndex) {
+    MELParticleSystem *self = playdate->system->realloc(NULL, sizeof(MELParticleSystem));
+
+    // Une seule allocation pour tous les champs.
+    const size_t floatCount = capacity * 4;
+    const size_t timeIntervalCount = capacity * 2;
+    uint8_t *memory = playdate->system->realloc(NULL, floatCount * sizeof(float) + timeIntervalCount * sizeof(MELTimeInterval) + capacity * sizeof(uint8_t));
+    float *floats = (float *) memory;
+    MELTimeInterval *timeIntervals = (MELTimeInterval *) (floats + floatCount);
+
+    *self = (MELParticleSystem) {
+        .capacity = capacity,
+        .x = floats,
+        .y = floats + capacity,
+        .speedX = floats + capacity * 2,
+        .speedY = floats + capacity * 3,
+        .age = timeIntervals,
+        .lifetime = timeIntervals + capacity,
+        .kind = (uint8_t *) (timeIntervals + timeIntervalCount),
+        .kinds = MELParticleKindListEmpty,
+        .next = systems,
+    };
+    systems = self;
+
+    LCDSprite *sprite = playdate->sprite->newSprite();
+    playdate->sprite->setSize(sprite, LCD_COLUMNS, LCD_ROWS);
+    playdate->sprite->moveTo(sprite, LCD_COLUMNS / 2.0f, LCD_ROWS / 2.0f);
+    playdate->sprite->setZIndex(sprite, zIndex);
+    playdate->sprite->setUserdata(sprite, self);
+    playdate->sprite->setUpdateFunction(sprite, update);
+    playdate->sprite->setDrawFunction(sprite, draw);
+    playdate->sprite->addSprite(sprite);
+    self->sprite = sprite;
+    return self;
+}
+
+void MELParticleSystemDealloc(MELParticleSystem * _Nonnull self) {
+    MELParticleSystem **link = &systems;
+    while (*link != NULL && *link != self) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        *link = self->next;
+    }
+    playdate->sprite->removeSprite(self->sprite);
+    playdate->sprite->freeSprite(self->sprite);
+    for (unsigned int index = 0; index < self->kinds.count; index++) {
+        playdate->system->realloc(self->kinds.memory[index].frames, 0);
+    }
+    MELParticleKindListDeinit(&self->kinds);
+    playdate->system->realloc(self->x, 0);
+    playdate->system->realloc(self, 0);
+}
+
+MELParticleEmitter MELParticleEmitterMakeWithShootingStyleDefinition(const MELShootingStyleDefinition * _Nonnull definition) {
+    return (MELParticleEmitter) {
+        .definition = definition->bulletDefinition,
+        .animationName = definition->bulletAnimationName,
+        .amount = MELIntMax(definition->bulletAmount, 1),
+        .space = definition->space,
+        .speed = definition->bulletSpeed,
+        .angleVariation = MEL_2_PI,
+    };
+}
+
+void MELParticleSystemEmit(MELParticleSystem * _Nonnull self, const MELParticleEmitter * _Nonnull emitter, MELPoint origin) {
+    const MELAnimationDefinition *animation = MELSpriteDefinitionGetAnimationDefinition(*emitter->definition, emitter->animationName, MELAnimationDirectionRight);
+    if (animation == NULL || animation->frameCount == 0) {
+        return;
+    }
+    const int kind = kindIndexForAnimation(self, emitter->definition, animation);
+    if (kind < 0) {
+        return;
+    }
+    MELTimeInterval lifetime = emitter->lifetime;
+    if (lifetime <= 0.0f) {
+        lifetime = animation->frequency > 0 ? (MELTimeInterval) animation->frameCount / animation->frequency : 1.0f;
+    }
+
+    const unsigned int start = self->count;
+    const int amount = emitter->amount + (emitter->amountVariation > 0 ? MELRandomInt(emitter->amountVariation + 1) : 0);
+    const float space = emitter->space;
+    for (int index = 0; index < amount; index++) {
+        const float speed = emitter->speed + MELRandomFloat(emitter->speedVariation);
+        const MELPoint direction = MELTrigTableDirection(emitter->angle + MELRandomFloat(emitter->angleVariation));
+        push(self,
+             origin.x + MELRandomFloat(space) - space / 2,
+             origin.y + MELRandomFloat(space) - space / 2,
+             direction.x * speed,
+             direction.y * speed,
+             lifetime,
+             kind);
+    }
+    // Les nouvelles particules sont ajoutées à `bounds` pour être effacées à la prochaine mise à jour.
+    const LCDRect bounds = boundsOfParticles(self, start);
+    addDirtyRect(bounds);
+    self->bounds = rectUnion(self->bounds, bounds);
+}
+
+void MELParticleSystemEmitOne(MELParticleSystem * _Nonnull self, MELSpriteDefinition * _Nonnull definition, AnimationName animationName, MELPoint origin) {
+    const MELParticleEmitter emitter = (MELParticleEmitter) {
+        .definition = definition,
+        .animationName = animationName,
+        .amount = 1,
+    };
+    MELParticleSystemEmit(self, &emitter, origin);
+}
+
+void MELParticleSystemClear(MELParticleSystem * _Nonnull self) {
+    self->count = 0;
+    addDirtyRect(self->bounds);
+    self->bounds = (LCDRect) {};
+}
+
+void MELParticleSystemRemovePalette(LCDBitmapTable * _Nonnull palette) {
+    for (MELParticleSystem *self = systems; self != NULL; self = self->next) {
+        MELParticleKind *kinds = self->kinds.memory;
+        MELBoolean hasRemovedKind = false;
+        for (unsigned int index = 0; index < self->kinds.count; index++) {
+            if (kinds[index].animation != NULL && kinds[index].palette == palette) {
+                playdate->system->realloc(kinds[index].frames, 0);
+                kinds[index] = (MELParticleKind) {};
+                hasRemovedKind = true;
+            }
+        }
+        if (!hasRemovedKind) {
+            continue;
+        }
+        unsigned int index = 0;
+        while (index < self->count) {
+            if (kinds[self->kind[index]].animation == NULL) {
+                removeParticle(self, index);
+            } else {
+                index++;
+            }
+        }
+        addDirtyRect(self->bounds);
+    }
+}
+
+static void update(LCDSprite * _Nonnull sprite) {
+    MELParticleSystem *self = playdate->sprite->getUserdata(sprite);
+    const unsigned int count = self->count;
+    if (count == 0) {
+        if (self->bounds.left < self->bounds.right) {
+            addDirtyRect(self->bounds);
+            self->bounds = (LCDRect) {};
+        }
+        return;
+    }
+    const MELTimeInterval delta = DELTA;
+    float *x = self->x;
+    float *y = self->y;
+    float *speedX = self->speedX;
+    float *speedY = self->speedY;
+    MELTimeInterval *age = self->age;
+
+    for (unsigned int index = 0; index < count; index++) {
+        x[index] += speedX[index] * delta;
+        y[index] += speedY[index] * delta;
+        age[index] += delta;
+    }
+
+    // Retire les particules mortes en déplaçant les dernières à leur place.
+    const MELTimeInterval *lifetime = self->lifetime;
+    unsigned int index = 0;
+    while (index < self->count) {
+        if (age[index] < lifetime[index]) {
+            index++;
+        } else {
+            removeParticle(self, index);
+        }
+    }
+
+    // Seules les zones couvertes avant et après le déplacement sont redessinées.
+    const LCDRect bounds = boundsOfParticles(self, 0);
+    addDirtyRect(rectUnion(self->bounds, bounds));
+    self->bounds = bounds;
+}
+
+static void draw(LCDSprite * _Nonnull sprite, PDRect bounds, PDRect drawrect) {
+    MELParticleSystem *self = playdate->sprite->getUserdata(sprite);
+    const unsigned int count = self->count;
+    const float *x = self->x;
+    const float *y = self->y;
+    const MELTimeInterval *age = self->age;
+    const uint8_t *kinds = self->kind;
+    const MELParticleKind *kindMemory = self->kinds.memory;
+
+    for (unsigned int index = 0; index < count; index++) {
+        const MELParticleKind *kind = kindMemory + kinds[index];
+        const unsigned int frameIndex = ((unsigned int) (age[index] * kind->frequency)) % kind->frameCount;
+        LCDBitmap *bitmap = kind->frames[frameIndex];
+        if (bitmap == NULL) {
+            continue;
+        }
+        // Les explosions sont placées sans `MOVETO_XY` : les particules aussi.
+        playdate->graphics->drawBitmap(bitmap, (int) x[index] - kind->halfWidth, (int) y[index] - kind->halfHeight, kBitmapUnflipped);
+    }
+}
+
+static int kindIndexForAnimation(MELParticleSystem * _Nonnull self, MELSpriteDefinition * _Nonnull definition, const MELAnimationDefinition * _Nonnull animation) {
+    MELParticleKindList *kinds = &self->kinds;
+    int freeIndex = -1;
+    for (unsigned int index = 0; index < kinds->count; index++) {
+        const MELParticleKind *kind = kinds->memory + index;
+        if (kind->animation == animation && kind->palette == definition->palette) {
+            return index;
+        } else if (kind->animation == NULL && freeIndex < 0) {
+            freeIndex = index;
+        }
+    }
+    if (freeIndex < 0 && kinds->count == MAX_KIND_COUNT) {
+        playdate->system->error("Too many particle kinds, max: %d", MAX_KIND_COUNT);
+        return -1;
+    }
+
+    const unsigned int frameCount = animation->frameCount;
+    LCDBitmap **frames = playdate->system->realloc(NULL, frameCount * sizeof(LCDBitmap *));
+    for (unsigned int index = 0; index < frameCount; index++) {
+        frames[index] = playdate->graphics->getTableBitmap(definition->palette, animation->frames[index].atlasIndex);
+    }
+    int width = 0;
+    int height = 0;
+    if (frames[0] != NULL) {
+        playdate->graphics->getBitmapData(frames[0], &width, &height, NULL, NULL, NULL);
+    }
+    const MELParticleKind kind = (MELParticleKind) {
+        .animation = animation,
+        .palette = definition->palette,
+        .frames = frames,
+        .frameCount = frameCount,
+        .frequency = animation->frequency,
+        .halfWidth = width / 2,
+        .halfHeight = height / 2,
+    };
+    if (freeIndex >= 0) {
+        kinds->memory[freeIndex] = kind;
+        return freeIndex;
+    }
+    if (kinds->memory == NULL) {
+        *kinds = MELParticleKindListMake();
+    }
+    MELParticleKindListPush(kinds, kind);
+    return kinds->count - 1;
+}
+
+static void push(MELParticleSystem * _Nonnull self, float x, float y, float speedX, float speedY, MELTimeInterval lifetime, uint8_t kind) {
+    const unsigned int index = self->count;
+    if (index == self->capacity) {
+        return;
+    }
+    self->x[index] = x;
+    self->y[index] = y;
+    self->speedX[index] = speedX;
+    self->speedY[index] = speedY;
+    self->age[index] = 0;
+    self->lifetime[index] = lifetime;
+    self->kind[index] = kind;
+    self->count = index + 1;
+}
+
+static void removeParticle(MELParticleSystem * _Nonnull self, unsigned int index) {
+    const unsigned int last = --self->count;
+    self->x[index] = self->x[last];
+    self->y[index] = self->y[last];
+    self->speedX[index] = self->speedX[last];
+    self->speedY[index] = self->speedY[last];
+    self->age[index] = self->age[last];
+    self->lifetime[index] = self->lifetime[last];
+    self->kind[index] = self->kind[last];
+}
+
+/**
+ * Calcule la zone de l'écran couverte par les particules à partir de l'index `start`.
+ *
+ * @return La zone couverte ou un rectangle vide s'il n'y a aucune particule.
+ */
+static LCDRect boundsOfParticles(MELParticleSystem * _Nonnull self, unsigned int start) {
+    const unsigned int count = self->count;
+    if (start >= count) {
+        return (LCDRect) {};
+    }
+    const float *x = self->x;
+    const float *y = self->y;
+    const uint8_t *kinds = self->kind;
+    const MELParticleKind *kindMemory = self->kinds.memory;
+    LCDRect bounds = (LCDRect) {
+        .left = INT_MAX,
+        .right = INT_MIN,
+        .top = INT_MAX,
+        .bottom = INT_MIN,
+    };
+    for (unsigned int index = start; index < count; index++) {
+        const MELParticleKind *kind = kindMemory + kinds[index];
+        const int left = (int) x[index] - kind->halfWidth;
+        const int top = (int) y[index] - kind->halfHeight;
+        // + 1 pour les images de largeur ou de hauteur impaire.
+        const int right = (int) x[index] + kind->halfWidth + 1;
+        const int bottom = (int) y[index] + kind->halfHeight + 1;
+        bounds.left = MELIntMin(bounds.left, left);
+        bounds.top = MELIntMin(bounds.top, top);
+        bounds.right = MELIntMax(bounds.right, right);
+        bounds.bottom = MELIntMax(bounds.bottom, bottom);
+    }
+    return bounds;
+}
+
+static LCDRect rectUnion(LCDRect lhs, LCDRect rhs) {
+    if (lhs.left >= lhs.right) {
+        return rhs;
+    } else if (rhs.left >= rhs.right) {
+        return lhs;
+    }
+    return (LCDRect) {
+        .left = MELIntMin(lhs.left, rhs.left),
+        .right = MELIntMax(lhs.right, rhs.right),
+        .top = MELIntMin(lhs.top, rhs.top),
+        .bottom = MELIntMax(lhs.bottom, rhs.bottom),
+    };
+}
+
+static void addDirtyRect(LCDRect rect) {
+    if (rect.left < rect.right && rect.top < rect.bottom) {
+        playdate->sprite->addDirtyRect(rect);
+    }
+}
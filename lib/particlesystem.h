@@ -0,0 +1,142 @@
+//
+//  particlesystem.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef particlesystem_h
+#define particlesystem_h
+
+#include "melstd.h"
+
+#include "point.h"
+#include "animationdefinition.h"
+#include "spritedefinition.h"
+#include "shootingstyledefinition.h"
+#include "list.h"
+
+#include "../gen/animationnames.h"
+
+/**
+ * Animation partagée par plusieurs particules.
+ */
+typedef struct {
+    /// Animation jouée. NULL si l'emplacement est libre.
+    const MELAnimationDefinition * _Nullable animation;
+    /// Palette dont viennent les images de `frames`.
+    LCDBitmapTable * _Nullable palette;
+    /// Images de chaque frame de l'animation.
+    LCDBitmap * _Nullable * _Nullable frames;
+    unsigned int frameCount;
+    int frequency;
+    int halfWidth;
+    int halfHeight;
+} MELParticleKind;
+
+MELListDefine(MELParticleKind);
+
+/**
+ * Configuration d'une émission de particules.
+ */
+typedef struct {
+    /// Définition des sprites dont l'animation est utilisée.
+    MELSpriteDefinition * _Nonnull definition;
+    /// Nom de l'animation à utiliser.
+    AnimationName animationName;
+    /// Nombre de particules émises.
+    int amount;
+    /// Nombre aléatoire de particules ajoutées à `amount`.
+    int amountVariation;
+    /// Côté du carré dans lequel les particules apparaissent.
+    float space;
+    /// Vitesse des particules en pixels par seconde.
+    float speed;
+    /// Variation aléatoire ajoutée à `speed`.
+    float speedVariation;
+    /// Direction des particules en radians.
+    float angle;
+    /// Variation aléatoire de la direction. `MEL_2_PI` pour toutes les directions.
+    float angleVariation;
+    /// Durée de vie des particules. Si 0, durée de l'animation.
+    MELTimeInterval lifetime;
+} MELParticleEmitter;
+
+/**
+ * Système de particules stockées par champ (structure de tableaux).
+ *
+ * Les particules ne sont pas des sprites : elles n'ont ni hitbox, ni classe, ni animation allouée.
+ * Elles sont toutes dessinées par un unique `LCDSprite` couvrant l'écran. Les positions sont
+ * exprimées en coordonnées écran, comme celles des explosions.
+ */
+typedef struct melparticlesystem {
+    unsigned int count;
+    unsigned int capacity;
+
+    float * _Nonnull x;
+    float * _Nonnull y;
+    float * _Nonnull speedX;
+    float * _Nonnull speedY;
+    MELTimeInterval * _Nonnull age;
+    MELTimeInterval * _Nonnull lifetime;
+    uint8_t * _Nonnull kind;
+
+    MELParticleKindList kinds;
+    LCDSprite * _Nonnull sprite;
+    /// Zone de l'écran couverte par les particules lors de la dernière mise à jour. Vide si `left >= right`.
+    LCDRect bounds;
+    /// Système de particules alloué suivant.
+    struct melparticlesystem * _Nullable next;
+} MELParticleSystem;
+
+/**
+ * Alloue un système de particules et ajoute son sprite à la liste d'affichage.
+ *
+ * @param capacity Nombre maximum de particules. Les émissions au delà sont ignorées.
+ * @param zIndex Z-index du sprite dessinant les particules.
+ * @return Un nouveau système de particules.
+ */
+MELParticleSystem * _Nonnull MELParticleSystemAlloc(unsigned int capacity, int16_t zIndex);
+void MELParticleSystemDealloc(MELParticleSystem * _Nonnull self);
+
+/**
+ * Crée une configuration d'émission à partir d'un style de tir.
+ *
+ * @param definition Définition du style de tir.
+ * @return Une configuration émettant `bulletAmount` particules à la vitesse `bulletSpeed` dans toutes les directions.
+ */
+MELParticleEmitter MELParticleEmitterMakeWithShootingStyleDefinition(const MELShootingStyleDefinition * _Nonnull definition);
+
+/**
+ * Émet des particules.
+ *
+ * @param self Système de particules.
+ * @param emitter Configuration de l'émission.
+ * @param origin Centre de l'émission, en coordonnées écran.
+ */
+void MELParticleSystemEmit(MELParticleSystem * _Nonnull self, const MELParticleEmitter * _Nonnull emitter, MELPoint origin);
+
+/**
+ * Émet une seule particule immobile jouant l'animation donnée.
+ *
+ * @param self Système de particules.
+ * @param definition Définition du sprite dont l'animation est utilisée.
+ * @param animationName Nom de l'animation.
+ * @param origin Position de la particule, en coordonnées écran.
+ */
+void MELParticleSystemEmitOne(MELParticleSystem * _Nonnull self, MELSpriteDefinition * _Nonnull definition, AnimationName animationName, MELPoint origin);
+
+/**
+ * Retire toutes les particules.
+ */
+void MELParticleSystemClear(MELParticleSystem * _Nonnull self);
+
+/**
+ * Retire de tous les systèmes de particules les particules dont les images viennent de la palette donnée.
+ * Appelé par `MELSpriteDefinitionFreePalette` avant de libérer la palette.
+ *
+ * @param palette Palette sur le point d'être libérée.
+ */
+void MELParticleSystemRemovePalette(LCDBitmapTable * _Nonnull palette);
+
+#endif /* particlesystem_h */
@@ -7,6 +7,7 @@
 
 #include "particuleshootingstyle.h"
 
+#include "particlesystem.h"
 #include "../src/explosion.h"
 
 static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
@@ -25,7 +26,7 @@ void ParticuleShootingStyleInit(MELShootingStyle * _Nonnull self, const MELShoot
         .class = &ParticuleShootingStyleClass,
         .definition = definition,
         .shootInterval = MELRandomFloat(definition->shootInterval),
-        .bulletAmount = definition->bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->bulletAmount),
         .bulletAmountVariation = definition->bulletAmountVariation,
         .inversionInterval = definition->inversionInterval,
         .canShootWhenHitPointsAreZero = true,
@@ -34,6 +35,19 @@ void ParticuleShootingStyleInit(MELShootingStyle * _Nonnull self, const MELShoot
 
 static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
     const MELShootingStyleDefinition *definition = self->definition;
+    MELParticleSystem *particleSystem = currentScene->particleSystem;
+    if (particleSystem) {
+        // Même rendu que l'explosion créée sans système de particules : une seule particule immobile
+        // placée au hasard dans le carré `space`.
+        const MELParticleEmitter emitter = (MELParticleEmitter) {
+            .definition = definition->bulletDefinition,
+            .animationName = AnimationNameStand,
+            .amount = 1,
+            .space = definition->space,
+        };
+        MELParticleSystemEmit(particleSystem, &emitter, origin);
+        return;
+    }
     const float space = definition->space;
     ExplosionConstructorWithDefinition((MELPoint) {
         .x = origin.x + MELRandomFloat(space) - space / 2,
@@ -43,3 +43,104 @@ MELRectangle MELQuadrilateralGetEnclosingRectangle(MELQuadrilateral self) {
     const float bottom = MELQuadrilateralGetBottom(self);
     return MELRectangleMake(left, top, right - left, bottom - top);
 }
+
+MELQuadrilateral MELQuadrilateralMakeWithRectangle(MELRectangle rectangle) {
+    const float left = MELRectangleOriginIsCenterGetLeft(rectangle);
+    const float right = MELRectangleOriginIsCenterGetRight(rectangle);
+    const float top = MELRectangleOriginIsCenterGetTop(rectangle);
+    const float bottom = MELRectangleOriginIsCenterGetBottom(rectangle);
+    return (MELQuadrilateral) {
+        .topLeft = {left, top},
+        .topRight = {right, top},
+        .bottomLeft = {left, bottom},
+        .bottomRight = {right, bottom},
+    };
+}
+
+MELQuadrilateral MELQuadrilateralMakeWithCenterSizeAndAxes(MELPoint center, MELSize size, const MELPoint * _Nonnull axes) {
+    const MELPoint horizontal = MELPointMultiplyByValue(axes[0], size.width / 2);
+    const MELPoint vertical = MELPointMultiplyByValue(axes[1], size.height / 2);
+    return (MELQuadrilateral) {
+        .topLeft = {center.x - horizontal.x - vertical.x, center.y - horizontal.y - vertical.y},
+        .topRight = {center.x + horizontal.x - vertical.x, center.y + horizontal.y - vertical.y},
+        .bottomLeft = {center.x - horizontal.x + vertical.x, center.y - horizontal.y + vertical.y},
+        .bottomRight = {center.x + horizontal.x + vertical.x, center.y + horizontal.y + vertical.y},
+    };
+}
+
+void MELQuadrilateralGetAxes(MELQuadrilateral self, MELPoint * _Nonnull axes) {
+    axes[0] = MELPointSubstract(self.topRight, self.topLeft);
+    axes[1] = MELPointSubstract(self.bottomLeft, self.topLeft);
+}
+
+static inline float dot(MELPoint lhs, MELPoint rhs) {
+    return lhs.x * rhs.x + lhs.y * rhs.y;
+}
+
+static void project(const MELPoint * _Nonnull points, unsigned int count, MELPoint axe, float * _Nonnull min, float * _Nonnull max) {
+    float lower = dot(points[0], axe);
+    float upper = lower;
+    for (unsigned int index = 1; index < count; index++) {
+        const float value = dot(points[index], axe);
+        lower = MELFloatMin(lower, value);
+        upper = MELFloatMax(upper, value);
+    }
+    *min = lower;
+    *max = upper;
+}
+
+static MELBoolean isSeparatedOnAxes(const MELPoint * _Nonnull points, unsigned int count, const MELPoint * _Nonnull otherPoints, unsigned int otherCount, const MELPoint * _Nonnull axes, unsigned int axeCount) {
+    for (unsigned int index = 0; index < axeCount; index++) {
+        float min, max, otherMin, otherMax;
+        project(points, count, axes[index], &min, &max);
+        project(otherPoints, otherCount, axes[index], &otherMin, &otherMax);
+        if (max < otherMin || otherMax < min) {
+            return true;
+        }
+    }
+    return false;
+}
+
+MELBoolean MELQuadrilateralContainsPoint(MELQuadrilateral self, MELPoint point) {
+    MELPoint axes[2];
+    MELQuadrilateralGetAxes(self, axes);
+    return !isSeparatedOnAxes((const MELPoint *) &self, 4, &point, 1, axes, 2);
+}
+
+MELBoolean MELQuadrilateralIntersectsQuadrilateralOnAxes(MELQuadrilateral self, MELQuadrilateral other, const MELPoint * _Nonnull axes, unsigned int axeCount) {
+    return !isSeparatedOnAxes((const MELPoint *) &self, 4, (const MELPoint *) &other, 4, axes, axeCount);
+}
+
+MELBoolean MELQuadrilateralIntersectsQuadrilateral(MELQuadrilateral self, MELQuadrilateral other) {
+    MELPoint axes[4];
+    MELQuadrilateralGetAxes(self, axes);
+    MELQuadrilateralGetAxes(other, axes + 2);
+    return MELQuadrilateralIntersectsQuadrilateralOnAxes(self, other, axes, 4);
+}
+
+MELBoolean MELQuadrilateralIntersectsSegment(MELQuadrilateral self, const MELPoint * _Nonnull axes, MELSegment segment) {
+    const MELPoint allAxes[3] = {
+        axes[0],
+        axes[1],
+        // Normale du segment.
+        {segment.from.y - segment.to.y, segment.to.x - segment.from.x},
+    };
+    return !isSeparatedOnAxes((const MELPoint *) &self, 4, (const MELPoint *) &segment, 2, allAxes, 3);
+}
+
+float MELQuadrilateralDistanceToSegment(MELQuadrilateral self, const MELPoint * _Nonnull axes, MELSegment segment) {
+    if (MELQuadrilateralIntersectsSegment(self, axes, segment)) {
+        return 0.0f;
+    }
+    const MELSegment sides[4] = {
+        {self.topLeft, self.topRight},
+        {self.topRight, self.bottomRight},
+        {self.bottomRight, self.bottomLeft},
+        {self.bottomLeft, self.topLeft},
+    };
+    float distance = MELSegmentDistanceToSegment(sides[0], segment);
+    for (int index = 1; index < 4; index++) {
+        distance = MELFloatMin(distance, MELSegmentDistanceToSegment(sides[index], segment));
+    }
+    return distance;
+}
@@ -12,6 +12,7 @@
 #include "melstd.h"
 
 #include "point.h"
+#include "segment.h"
 
 typedef struct melrectangle MELRectangle;
 
@@ -31,4 +32,61 @@ float MELQuadrilateralGetBottom(MELQuadrilateral self);
 
 MELRectangle MELQuadrilateralGetEnclosingRectangle(MELQuadrilateral self);
 
+/**
+ * Creates a quadrilateral with the corners of the given rectangle.
+ *
+ * @param rectangle Rectangle whose origin is its center.
+ */
+MELQuadrilateral MELQuadrilateralMakeWithRectangle(MELRectangle rectangle);
+
+/**
+ * Creates a rectangle of the given size rotated around its center.
+ *
+ * @param center Center of the rectangle.
+ * @param size Size of the rectangle before rotation.
+ * @param axes Cosine and sine of the rotation angle for the first axe, (-sine, cosine) for the second one.
+ */
+MELQuadrilateral MELQuadrilateralMakeWithCenterSizeAndAxes(MELPoint center, MELSize size, const MELPoint * _Nonnull axes);
+
+/**
+ * Fills `axes` with the directions of the top and left sides.
+ * For rectangles, they are the only axes to test with the separating axis theorem. The axes are not normalized.
+ */
+void MELQuadrilateralGetAxes(MELQuadrilateral self, MELPoint * _Nonnull axes);
+
+/**
+ * Returns true if the given point is inside the quadrilateral. The quadrilateral must be a parallelogram.
+ */
+MELBoolean MELQuadrilateralContainsPoint(MELQuadrilateral self, MELPoint point);
+
+/**
+ * Separating axis test between two quadrilaterals.
+ *
+ * @param self First quadrilateral.
+ * @param other Second quadrilateral.
+ * @param axes Axes to test. For two rectangles, the axes of both (see `MELQuadrilateralGetAxes`).
+ * @param axeCount Number of axes.
+ * @return true if no axe separates the quadrilaterals.
+ */
+MELBoolean MELQuadrilateralIntersectsQuadrilateralOnAxes(MELQuadrilateral self, MELQuadrilateral other, const MELPoint * _Nonnull axes, unsigned int axeCount);
+
+/**
+ * Separating axis test between two rotated rectangles.
+ */
+MELBoolean MELQuadrilateralIntersectsQuadrilateral(MELQuadrilateral self, MELQuadrilateral other);
+
+/**
+ * Returns true if the segment crosses the quadrilateral or is inside it. The quadrilateral must be a parallelogram.
+ *
+ * @param self Quadrilateral.
+ * @param axes Axes of `self` (see `MELQuadrilateralGetAxes`).
+ * @param segment Segment.
+ */
+MELBoolean MELQuadrilateralIntersectsSegment(MELQuadrilateral self, const MELPoint * _Nonnull axes, MELSegment segment);
+
+/**
+ * Returns the smallest distance between the quadrilateral and the given segment. 0 if they intersect.
+ */
+float MELQuadrilateralDistanceToSegment(MELQuadrilateral self, const MELPoint * _Nonnull axes, MELSegment segment);
+
 #endif /* quadrilateral_h */
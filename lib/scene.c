@@ -65,7 +65,7 @@ void MELSceneAddOrRemoveBackToTitleMenuItem(void) {
 
 static LCDSprite * _Nullable findSpriteByName(MELScene * _Nonnull self, SpriteName spriteName) {
     void *(*getUserdata)(LCDSprite*) = playdate->sprite->getUserdata;
-    LCDSpriteRefList sprites = self->sprites;
+    LCDSpriteRefList sprites = self->sprites.values;
     for (unsigned int index = 0; index < sprites.count; index++) {
         LCDSprite *sprite = sprites.memory[index];
         MELSprite *melSprite = getUserdata(sprite);
@@ -97,7 +97,7 @@ LCDSprite * _Nullable MELSceneFindSpriteByName(SpriteName spriteName) {
 
 static LCDSprite * _Nullable findSpriteByClassName(MELScene * _Nonnull self, SpriteClassName className) {
     void *(*getUserdata)(LCDSprite*) = playdate->sprite->getUserdata;
-    LCDSpriteRefList sprites = self->sprites;
+    LCDSpriteRefList sprites = self->sprites.values;
     for (unsigned int index = 0; index < sprites.count; index++) {
         LCDSprite *sprite = sprites.memory[index];
         MELSprite *melSprite = getUserdata(sprite);
@@ -129,7 +129,7 @@ LCDSprite * _Nullable MELSceneFindSpriteByClassName(SpriteClassName className) {
 
 static LCDSprite * _Nullable findSpriteByTag(MELScene * _Nonnull self, const uint8_t tag) {
     uint8_t (*getTag)(LCDSprite*) = playdate->sprite->getTag;
-    LCDSpriteRefList sprites = self->sprites;
+    LCDSpriteRefList sprites = self->sprites.values;
     for (unsigned int index = 0; index < sprites.count; index++) {
         LCDSprite *sprite = sprites.memory[index];
         const uint8_t spriteTag = getTag(sprite);
@@ -166,6 +166,11 @@ void MELSceneFadeTo(MELScene * _Nonnull nextScene, MELScene * _Nonnull (* _Nonnu
     playdate->system->setUpdateCallback(fade->update, fade);
 }
 
+static void insertSprite(MELScene * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    melSprite->handle = LCDSpriteRefSlotMapInsert(&self->sprites, sprite);
+}
+
 void MELSceneAddSprite(LCDSprite * _Nonnull sprite) {
     if (currentScene->addSprite) {
         currentScene->addSprite(currentScene, sprite);
@@ -175,14 +180,14 @@ void MELSceneAddSprite(LCDSprite * _Nonnull sprite) {
         playdate->system->logToConsole("MELSceneAddSprite push sprite %x, name: %d, type: %d", sprite, melSprite != NULL ? melSprite->definition.type : 0, melSprite != NULL ? melSprite->definition.name : 0);
 #endif
 #if DEBUG
-        const LCDSpriteRefList sprites = currentScene->sprites;
+        const LCDSpriteRefList sprites = currentScene->sprites.values;
         for (unsigned int index = 0; index < sprites.count; index++) {
             if (sprites.memory[index] == sprite) {
                 playdate->system->error("MELSceneAddSprite error: trying to add sprite %x twice!", sprite);
             }
         }
 #endif
-        LCDSpriteRefListPush(&currentScene->sprites, sprite);
+        insertSprite(currentScene, sprite);
     }
 }
 
@@ -193,18 +198,41 @@ void MELFadeAddSprite(MELScene * _Nonnull scene, LCDSprite * _Nonnull sprite) {
         MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
         playdate->system->logToConsole("MELFadeAddSprite add sprite %x to oldScene, name: %d, type: %d", sprite, melSprite != NULL ? melSprite->definition.type : 0, melSprite != NULL ? melSprite->definition.name : 0);
 #endif
-        LCDSpriteRefListPush(&self->oldScene->sprites, sprite);
+        insertSprite(self->oldScene, sprite);
     } else if (self->nextScene != NULL) {
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
         MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
         playdate->system->logToConsole("MELFadeAddSprite add sprite %x to nextScene, name: %d, type: %d", sprite, melSprite != NULL ? melSprite->definition.type : 0, melSprite != NULL ? melSprite->definition.name : 0);
 #endif
-        LCDSpriteRefListPush(&self->nextScene->sprites, sprite);
+        insertSprite(self->nextScene, sprite);
     } else {
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
         MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
         playdate->system->logToConsole("MELFadeAddSprite add sprite %x to fade, name: %d, type: %d", sprite, melSprite != NULL ? melSprite->definition.type : 0, melSprite != NULL ? melSprite->definition.name : 0);
 #endif
-        LCDSpriteRefListPush(&self->super.sprites, sprite);
+        insertSprite(&self->super, sprite);
+    }
+}
+
+MELBoolean MELSceneRemoveSprite(MELScene * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    LCDSpriteRef *entry = LCDSpriteRefSlotMapGet(&self->sprites, melSprite->handle);
+    if (entry != NULL && *entry == sprite) {
+        LCDSpriteRefSlotMapRemove(&self->sprites, melSprite->handle);
+        melSprite->handle = MELHandleNull;
+        return true;
+    }
+    // La poignée vient d'une autre scène (pendant un fondu par exemple) : recherche du sprite.
+    const int index = LCDSpriteRefListIndexOf(self->sprites.values, sprite);
+    if (index < 0) {
+        return false;
     }
+    LCDSpriteRefSlotMapRemoveAtIndex(&self->sprites, index);
+    melSprite->handle = MELHandleNull;
+    return true;
+}
+
+LCDSprite * _Nullable MELSceneGetSprite(MELHandle handle) {
+    LCDSpriteRef *entry = LCDSpriteRefSlotMapGet(&MELSceneGetCurrent()->sprites, handle);
+    return entry != NULL ? *entry : NULL;
 }
@@ -17,6 +17,9 @@
 #include "../gen/spritenames.h"
 
 typedef struct melscene MELScene;
+typedef struct melcollisionworld MELCollisionWorld;
+typedef struct melspritebatch MELSpriteBatch;
+typedef struct melparticlesystem MELParticleSystem;
 
 typedef enum {
     SceneTypeTitle,
@@ -31,7 +34,14 @@ typedef struct melscene {
     int (* _Nonnull update)(void * _Nonnull self);
     void (* _Nullable beforeQuit)(MELScene * _Nonnull self);
     void (* _Nullable addSprite)(MELScene * _Nonnull self, LCDSprite * _Nonnull sprite);
-    LCDSpriteRefList sprites;
+    /// Sprites de la scène. `sprites.values` peut être parcourue comme une liste.
+    LCDSpriteRefSlotMap sprites;
+    /// Si défini, les sprites désalloués sont retirés des paires de collision. La scène est responsable de sa désallocation.
+    MELCollisionWorld * _Nullable collisionWorld;
+    /// Si défini, les sprites désalloués sont retirés du lot. La scène est responsable de sa désallocation.
+    MELSpriteBatch * _Nullable spriteBatch;
+    /// Si défini, les explosions et les tirs de particules sont émis dans ce système plutôt que sous forme de sprites. La scène est responsable de sa désallocation.
+    MELParticleSystem * _Nullable particleSystem;
 } MELScene;
 
 typedef struct melfade {
@@ -52,6 +62,21 @@ MELScene * _Nonnull MELSceneGetCurrent(void);
 void MELSceneAddOrRemoveBackToTitleMenuItem(void);
 void MELSceneAddSprite(LCDSprite * _Nonnull sprite);
 void MELFadeAddSprite(MELScene * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Retire le sprite donné des sprites de la scène, en O(1) grâce à sa poignée.
+ *
+ * @return true si le sprite a été trouvé et retiré.
+ */
+MELBoolean MELSceneRemoveSprite(MELScene * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Renvoie le sprite de la scène courante désigné par la poignée donnée.
+ *
+ * @note Les poignées ne sont valides que dans la scène où les sprites ont été ajoutés.
+ * @return Le sprite ou NULL s'il a été désalloué.
+ */
+LCDSprite * _Nullable MELSceneGetSprite(MELHandle handle);
 LCDSprite * _Nullable MELSceneFindSpriteByName(SpriteName spriteName);
 LCDSprite * _Nullable MELSceneFindSpriteByClassName(SpriteClassName className);
 LCDSprite * _Nullable MELSceneFindSpriteByTag(const uint8_t tag);
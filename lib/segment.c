@@ -6,3 +6,55 @@
 //
 
 #include "segment.h"
+
+#include "melmath.h"
+
+MELPoint MELSegmentClosestPointToPoint(MELSegment self, MELPoint point) {
+    const MELPoint direction = MELPointSubstract(self.to, self.from);
+    const float squareLength = direction.x * direction.x + direction.y * direction.y;
+    if (squareLength == 0.0f) {
+        return self.from;
+    }
+    const float t = MELFloatBound(0.0f, ((point.x - self.from.x) * direction.x + (point.y - self.from.y) * direction.y) / squareLength, 1.0f);
+    return MELPointMake(self.from.x + direction.x * t, self.from.y + direction.y * t);
+}
+
+float MELSegmentDistanceToPoint(MELSegment self, MELPoint point) {
+    return MELPointDistanceToPoint(MELSegmentClosestPointToPoint(self, point), point);
+}
+
+/**
+ * Signe de l'aire du triangle abc : > 0 si c est à gauche de ab, < 0 s'il est à droite et 0 si les points sont alignés.
+ */
+static float orientation(MELPoint a, MELPoint b, MELPoint c) {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+static MELBoolean isInBoundsOfSegment(MELSegment segment, MELPoint point) {
+    return point.x >= MELFloatMin(segment.from.x, segment.to.x) && point.x <= MELFloatMax(segment.from.x, segment.to.x)
+        && point.y >= MELFloatMin(segment.from.y, segment.to.y) && point.y <= MELFloatMax(segment.from.y, segment.to.y);
+}
+
+MELBoolean MELSegmentIntersectsSegment(MELSegment self, MELSegment other) {
+    const float o1 = orientation(self.from, self.to, other.from);
+    const float o2 = orientation(self.from, self.to, other.to);
+    const float o3 = orientation(other.from, other.to, self.from);
+    const float o4 = orientation(other.from, other.to, self.to);
+    if (((o1 > 0 && o2 < 0) || (o1 < 0 && o2 > 0)) && ((o3 > 0 && o4 < 0) || (o3 < 0 && o4 > 0))) {
+        return true;
+    }
+    // Points alignés.
+    return (o1 == 0 && isInBoundsOfSegment(self, other.from))
+        || (o2 == 0 && isInBoundsOfSegment(self, other.to))
+        || (o3 == 0 && isInBoundsOfSegment(other, self.from))
+        || (o4 == 0 && isInBoundsOfSegment(other, self.to));
+}
+
+float MELSegmentDistanceToSegment(MELSegment self, MELSegment other) {
+    if (MELSegmentIntersectsSegment(self, other)) {
+        return 0.0f;
+    }
+    return MELFloatMin(
+        MELFloatMin(MELSegmentDistanceToPoint(self, other.from), MELSegmentDistanceToPoint(self, other.to)),
+        MELFloatMin(MELSegmentDistanceToPoint(other, self.from), MELSegmentDistanceToPoint(other, self.to)));
+}
@@ -17,4 +17,28 @@ typedef struct {
     MELPoint to;
 } MELSegment;
 
+/**
+ * Returns the point of the segment closest to the given point.
+ *
+ * @param self Segment.
+ * @param point Point.
+ * @return The closest point, either one of the ends or a point between them.
+ */
+MELPoint MELSegmentClosestPointToPoint(MELSegment self, MELPoint point);
+
+/**
+ * Returns the distance between the segment and the given point.
+ */
+float MELSegmentDistanceToPoint(MELSegment self, MELPoint point);
+
+/**
+ * Returns true if the segments cross or touch each other.
+ */
+MELBoolean MELSegmentIntersectsSegment(MELSegment self, MELSegment other);
+
+/**
+ * Returns the smallest distance between two segments. 0 if they intersect.
+ */
+float MELSegmentDistanceToSegment(MELSegment self, MELSegment other);
+
 #endif /* segment_h */
@@ -11,11 +11,24 @@
 #include "circularshootingstyle.h"
 #include "simpleshootingstyle.h"
 #include "particuleshootingstyle.h"
+#include "aimedshootingstyle.h"
+#include "sinussimpleshootingstyle.h"
+#include "bullet.h"
 #include "sprite.h"
 #include "melmath.h"
+#include "trigtable.h"
+#include "random.h"
 
 extern float DELTA;
 
+/// Marque les sauvegardes écrites avec un numéro de version. Les anciennes commencent directement par le nom de la classe.
+#define kSaveVersionMarker 0xFF
+/// Version 1 : ajout de l'état de la salve en cours et de `randomState`.
+#define kSaveVersion 1
+
+/// Tirs en attente de création, créés en une fois à la fin de `MELShootingStyleShootFromSprite`.
+static MELBulletSpawnList pendingSpawns;
+
 static MELPoint shotOrigin(MELShotOrigin origin, MELRectangle frame, float angle) {
     switch (origin) {
         case MELShotOriginFront:
@@ -38,32 +51,113 @@ static void invert(MELShootingStyle * _Nonnull self, const MELShootingStyleInver
 }
 #endif
 
+/// Passe à l'état suivant du générateur pseudo-aléatoire (xorshift32). L'état ne doit pas être nul.
+static uint32_t nextRandomState(uint32_t state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+unsigned int MELShootingStyleClampBulletAmount(unsigned int bulletAmount) {
+    return bulletAmount < kMELShootingStyleMaximumBulletAmount ? bulletAmount : kMELShootingStyleMaximumBulletAmount;
+}
+
+static void compilePattern(MELShootingStyle * _Nonnull self) {
+    MELBulletPattern *pattern = &self->pattern;
+    MELBulletPatternInvalidate(pattern);
+    self->class->compile(self, pattern);
+    MELBulletPatternSortByDelay(pattern);
+    pattern->bulletAmount = self->bulletAmount;
+    pattern->isCompiled = true;
+}
+
+/// Émet les tirs de la salve en cours dont le délai est écoulé.
+static void emitDueBullets(MELShootingStyle * _Nonnull self, MELPoint origin) {
+    const MELBulletEmission *emissions = self->pattern.emissions;
+    const unsigned int count = self->pattern.count;
+    const MELTimeInterval volleyAge = self->volleyAge;
+    const MELPoint rotation = self->volleyRotation;
+    const float offsetScale = self->volleyOffsetScale;
+
+    unsigned int index = self->nextEmission;
+    for (; index < count && emissions[index].delay <= volleyAge; index++) {
+        const MELBulletEmission emission = emissions[index];
+        const MELPoint direction = emission.direction;
+        const MELPoint offset = emission.offset;
+        MELBulletSpawnListPush(&pendingSpawns, (MELBulletSpawn) {
+            .origin = {
+                .x = origin.x + (offset.x * rotation.x - offset.y * rotation.y) * offsetScale,
+                .y = origin.y + (offset.x * rotation.y + offset.y * rotation.x) * offsetScale,
+            },
+            .speed = {
+                .x = (direction.x * rotation.x - direction.y * rotation.y) * emission.speed,
+                .y = (direction.x * rotation.y + direction.y * rotation.x) * emission.speed,
+            },
+            .initialDelta = volleyAge - emission.delay,
+        });
+    }
+    self->nextEmission = index;
+}
+
+static void fireVolley(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
+    const MELShootingStyleClass *class = self->class;
+    if (class->createBullets) {
+        class->createBullets(self, origin, angle, initialDelta);
+        return;
+    }
+    MELBulletPattern *pattern = &self->pattern;
+    if (self->nextEmission < pattern->count) {
+        // Termine la salve précédente.
+        self->volleyAge = pattern->emissions[pattern->count - 1].delay;
+        emitDueBullets(self, origin);
+    }
+    if (class->isRandom) {
+        self->randomState = nextRandomState(self->randomState);
+        compilePattern(self);
+    } else if (!pattern->isCompiled || pattern->bulletAmount != self->bulletAmount) {
+        compilePattern(self);
+    }
+    const float volleyAngle = class->volleyAngle ? class->volleyAngle(self, origin, angle) : angle;
+    self->volleyRotation = MELTrigTableDirection(volleyAngle);
+    self->volleyOffsetScale = class->volleyOffsetScale ? class->volleyOffsetScale(self, self->time - initialDelta) : 1.0f;
+    self->volleyAge = initialDelta;
+    self->nextEmission = 0;
+    emitDueBullets(self, origin);
+}
+
 void MELShootingStyleShootFromSprite(MELShootingStyle * _Nonnull self, MELSprite * _Nonnull sprite, float angle) {
     if (!sprite->hitPoints && !self->canShootWhenHitPointsAreZero) {
         // Le sprite n'a plus de points de vie. Pas de tir.
         return;
     }
     const MELTimeInterval delta = DELTA;
-    MELTimeInterval shootInterval = self->shootInterval;
-    if (shootInterval > 0) {
-        shootInterval -= delta;
-    } else {
-        const float initialDelta = -shootInterval;
-        const MELShootingStyleDefinition *definition = self->definition;
-        shootInterval += definition->shootInterval;
+    self->time += delta;
+
+    const MELShootingStyleDefinition *definition = self->definition;
+    MELPoint origin = shotOrigin(definition->origin, sprite->frame, angle);
+    const MELPoint translation = definition->translation;
+    origin = (MELPoint) {
+        .x = origin.x + translation.x,
+        .y = origin.y + translation.y
+    };
+
+    if (self->nextEmission < self->pattern.count) {
+        // Tirs retardés de la salve en cours.
+        self->volleyAge += delta;
+        emitDueBullets(self, origin);
+    }
 
-        MELPoint origin = shotOrigin(definition->origin, sprite->frame, angle);
-        const MELPoint translation = definition->translation;
-        origin = (MELPoint) {
-            .x = origin.x + translation.x,
-            .y = origin.y + translation.y
-        };
+    // Tire toutes les salves prévues pendant la frame, même si l'interval est plus court que DELTA.
+    // Chaque salve est avancée du temps écoulé depuis le moment où elle aurait dû être tirée.
+    MELTimeInterval shootInterval = self->shootInterval - delta;
+    while (shootInterval <= 0) {
+        const float initialDelta = -shootInterval;
 
         // Salve de tir
-        // TODO: Calculer le décalage initial des tirs en fonction de la valeur de shootInterval.
-        self->class->createBullets(self, origin, angle, initialDelta);
+        fireVolley(self, origin, angle, initialDelta);
 
-        self->bulletAmount += definition->bulletAmountVariation;
+        self->bulletAmount = MELShootingStyleClampBulletAmount(self->bulletAmount + definition->bulletAmountVariation);
 
 #if ENABLE_SHOOTING_STYLE_INVERSIONS
         const MELShootingStyleInversion inversions = definition->inversions;
@@ -74,11 +168,24 @@ void MELShootingStyleShootFromSprite(MELShootingStyle * _Nonnull self, MELSprite
             invert(self, inversions);
         }
 #endif
+        if (definition->shootInterval <= 0) {
+            // Au plus une salve par frame.
+            shootInterval = 0;
+            break;
+        }
+        shootInterval += definition->shootInterval;
     }
     self->shootInterval = shootInterval;
+
+    if (pendingSpawns.count > 0) {
+        BulletConstructorWithSpawns(definition, pendingSpawns.memory, pendingSpawns.count);
+        MELBulletSpawnListClear(&pendingSpawns);
+    }
 }
 
 void MELShootingStyleSave(MELShootingStyle * _Nonnull self, MELOutputStream * _Nonnull outputStream) {
+    MELOutputStreamWriteByte(outputStream, kSaveVersionMarker);
+    MELOutputStreamWriteByte(outputStream, kSaveVersion);
     MELOutputStreamWriteByte(outputStream, self->class->name);
 
     MELOutputStreamWriteFloat(outputStream, self->shootInterval);
@@ -87,10 +194,21 @@ void MELShootingStyleSave(MELShootingStyle * _Nonnull self, MELOutputStream * _N
     MELOutputStreamWriteUInt32(outputStream, self->inversionInterval);
     MELOutputStreamWriteFloat(outputStream, self->baseAngle);
     MELOutputStreamWriteBoolean(outputStream, self->canShootWhenHitPointsAreZero);
+    MELOutputStreamWriteFloat(outputStream, self->time);
+    MELOutputStreamWriteUInt32(outputStream, self->randomState);
+    MELOutputStreamWriteUInt32(outputStream, self->nextEmission);
+    MELOutputStreamWriteFloat(outputStream, self->volleyAge);
+    MELOutputStreamWritePoint(outputStream, self->volleyRotation);
+    MELOutputStreamWriteFloat(outputStream, self->volleyOffsetScale);
 }
 
 MELShootingStyle MELShootingStyleLoad(MELInputStream * _Nonnull inputStream, const MELShootingStyleDefinition * _Nonnull definition) {
+    uint8_t version = 0;
     MELShootingStyleClassName className = MELInputStreamReadByte(inputStream);
+    if (className == kSaveVersionMarker) {
+        version = MELInputStreamReadByte(inputStream);
+        className = MELInputStreamReadByte(inputStream);
+    }
 
     const float shootInterval = MELInputStreamReadFloat(inputStream);
     const uint32_t bulletAmount = MELInputStreamReadUInt32(inputStream);
@@ -99,16 +217,43 @@ MELShootingStyle MELShootingStyleLoad(MELInputStream * _Nonnull inputStream, con
     const float baseAngle = MELInputStreamReadFloat(inputStream);
     const MELBoolean canShootWhenHitPointsAreZero = MELInputStreamReadBoolean(inputStream);
 
-    return (MELShootingStyle) {
+    // Les sauvegardes sans version ne contiennent pas de salve en cours : la suivante part de zéro.
+    MELTimeInterval time = 0.0f;
+    uint32_t randomState = (uint32_t) MELRandomInt(INT32_MAX) + 1;
+    uint32_t nextEmission = UINT32_MAX;
+    MELTimeInterval volleyAge = 0.0f;
+    MELPoint volleyRotation = MELPointMake(1.0f, 0.0f);
+    float volleyOffsetScale = 1.0f;
+    if (version >= 1) {
+        time = MELInputStreamReadFloat(inputStream);
+        randomState = MELInputStreamReadUInt32(inputStream);
+        nextEmission = MELInputStreamReadUInt32(inputStream);
+        volleyAge = MELInputStreamReadFloat(inputStream);
+        volleyRotation = MELInputStreamReadPoint(inputStream);
+        volleyOffsetScale = MELInputStreamReadFloat(inputStream);
+    }
+
+    MELShootingStyle self = (MELShootingStyle) {
         .class = MELShootingStyleClassForName(className),
         .definition = definition,
         .shootInterval = shootInterval,
-        .bulletAmount = bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(bulletAmount),
         .bulletAmountVariation = bulletAmountVariation,
         .inversionInterval = inversionInterval,
         .baseAngle = baseAngle,
         .canShootWhenHitPointsAreZero = canShootWhenHitPointsAreZero,
+        .time = time,
+        .randomState = randomState,
+        .volleyAge = volleyAge,
+        .volleyRotation = volleyRotation,
+        .volleyOffsetScale = volleyOffsetScale,
     };
+    if (self.class && self.class->compile) {
+        // La table ne dépend que de la définition, du nombre de tirs et de `randomState` : elle est recompilée à l'identique.
+        compilePattern(&self);
+        self.nextEmission = nextEmission < self.pattern.count ? nextEmission : self.pattern.count;
+    }
+    return self;
 }
 
 const MELShootingStyleClass * _Nullable MELShootingStyleClassForName(MELShootingStyleClassName className) {
@@ -121,6 +266,10 @@ const MELShootingStyleClass * _Nullable MELShootingStyleClassForName(MELShooting
             return SimpleShootingStyleGetClass();
         case MELShootingStyleClassNameParticule:
             return ParticuleShootingStyleGetClass();
+        case MELShootingStyleClassNameAimed:
+            return AimedShootingStyleGetClass();
+        case MELShootingStyleClassNameSinus:
+            return SinusShootingStyleGetClass();
         default:
             playdate->system->error("Unsupported shooting style class: %d", className);
             return NULL;
@@ -9,6 +9,7 @@
 #define shootingstyle_h
 
 #include "shootingstyledefinition.h"
+#include "bulletpattern.h"
 
 typedef enum {
     MELShootingStyleClassNameBurst,
@@ -21,12 +22,27 @@ typedef enum {
 
 typedef struct {
     MELShootingStyleClassName name;
-    void (* _Nonnull createBullets)(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+    /// Remplit la table des tirs d'une salve de `self->bulletAmount` tirs. Les angles sont relatifs à l'angle de la salve.
+    void (* _Nullable compile)(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
+    /// Vrai si `compile` dépend de `randomState`. La table est alors recompilée à chaque salve.
+    MELBoolean isRandom;
+    /// Donne l'angle de la salve à partir de l'angle de tir. Si `NULL`, l'angle de tir est utilisé.
+    float (* _Nullable volleyAngle)(MELShootingStyle * _Nonnull self, MELPoint origin, float angle);
+    /// Donne le facteur appliqué aux décalages des tirs de la salve tirée à l'instant `time`. Si `NULL`, les décalages sont utilisés tels quels.
+    float (* _Nullable volleyOffsetScale)(MELShootingStyle * _Nonnull self, MELTimeInterval time);
+    /// Crée directement les tirs, pour les styles qui ne tirent pas de balles. Si défini, la table n'est pas utilisée.
+    void (* _Nullable createBullets)(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
 } MELShootingStyleClass;
 
 const MELShootingStyleClass * _Nullable MELShootingStyleClassForName(MELShootingStyleClassName className);
 
 
+/**
+ * Style de tir d'un sprite.
+ *
+ * Un style n'alloue pas de mémoire : il n'a pas besoin d'être libéré et peut être copié.
+ * En contrepartie, une salve compte au plus `kMELShootingStyleMaximumBulletAmount` tirs.
+ */
 typedef struct shootingstyle {
     const MELShootingStyleClass * _Nonnull class;
     const MELShootingStyleDefinition * _Nonnull definition;
@@ -41,8 +57,32 @@ typedef struct shootingstyle {
     float baseAngle;
 
     MELBoolean canShootWhenHitPointsAreZero;
+
+    /// Temps écoulé depuis l'initialisation du style. Remplace l'horloge système pour que les tirs soient rejoués à l'identique.
+    MELTimeInterval time;
+    /// État du générateur pseudo-aléatoire des styles aléatoires. Avancé à chaque salve et sauvegardé avec le style.
+    uint32_t randomState;
+
+    /// Table des tirs d'une salve, compilée à la demande.
+    MELBulletPattern pattern;
+    /// Index du prochain tir de la salve en cours.
+    unsigned int nextEmission;
+    /// Temps écoulé depuis le début de la salve en cours.
+    MELTimeInterval volleyAge;
+    /// Cosinus et sinus de l'angle de la salve en cours.
+    MELPoint volleyRotation;
+    /// Facteur appliqué aux décalages des tirs de la salve en cours.
+    float volleyOffsetScale;
 } MELShootingStyle;
 
+/// Nombre maximal de tirs d'une salve. `bulletAmount` est ramené à cette limite à l'initialisation, à chaque variation et au chargement.
+#define kMELShootingStyleMaximumBulletAmount kMELBulletPatternMaximumEmissionCount
+
+/**
+ * Ramène le nombre de tirs donné à `kMELShootingStyleMaximumBulletAmount`.
+ */
+unsigned int MELShootingStyleClampBulletAmount(unsigned int bulletAmount);
+
 void MELShootingStyleShootFromSprite(MELShootingStyle * _Nonnull self, MELSprite * _Nonnull sprite, float angle);
 
 void MELShootingStyleSave(MELShootingStyle * _Nonnull self, MELOutputStream * _Nonnull outputStream);
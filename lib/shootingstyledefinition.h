@@ -12,6 +12,7 @@
 
 #include "point.h"
 #include "spritedefinition.h"
+#include "bulletmotion.h"
 
 #include "../gen/animationnames.h"
 
@@ -70,6 +71,9 @@ typedef struct shootingstyledefinition {
 
     // Espace entre les tirs.
     float space;
+
+    /// Mouvement des tirs après leur création. Linéaire par défaut.
+    MELBulletMotion motion;
 } MELShootingStyleDefinition;
 
 #endif /* shootingstyledefinition_h */
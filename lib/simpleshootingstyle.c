@@ -7,15 +7,14 @@
 
 #include "simpleshootingstyle.h"
 
-#include "bullet.h"
 #include "melmath.h"
 #include "random.h"
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
 
 static const MELShootingStyleClass SimpleShootingStyleClass = (MELShootingStyleClass) {
     .name = MELShootingStyleClassNameSimple,
-    .createBullets = createBullets,
+    .compile = compile,
 };
 
 const MELShootingStyleClass * _Nonnull SimpleShootingStyleGetClass(void) {
@@ -27,17 +26,12 @@ void SimpleShootingStyleInit(MELShootingStyle * _Nonnull self, const MELShooting
         .class = &SimpleShootingStyleClass,
         .definition = definition,
         .shootInterval = MELRandomFloat(definition->shootInterval),
-        .bulletAmount = definition->bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->bulletAmount),
         .bulletAmountVariation = definition->bulletAmountVariation,
         .inversionInterval = definition->inversionInterval,
     };
 }
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
-    const MELShootingStyleDefinition *definition = self->definition;
-    const float bulletSpeed = definition->bulletSpeed;
-    BulletConstructor(definition, origin, (MELPoint) {
-        .x = bulletSpeed * cosf(angle),
-        .y = bulletSpeed * sinf(angle)
-    }, initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern) {
+    MELBulletPatternPush(pattern, MELBulletEmissionMake(0.0f, 0.0f, self->definition->bulletSpeed, MELPointZero));
 }
@@ -7,14 +7,19 @@
 
 #include "sinussimpleshootingstyle.h"
 
-#include "bullet.h"
+#include "melmath.h"
 #include "random.h"
+#include "trigtable.h"
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta);
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern);
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle);
+static float volleyOffsetScale(MELShootingStyle * _Nonnull self, MELTimeInterval time);
 
 static const MELShootingStyleClass SinusShootingStyleClass = (MELShootingStyleClass) {
     .name = MELShootingStyleClassNameSinus,
-    .createBullets = createBullets,
+    .compile = compile,
+    .volleyAngle = volleyAngle,
+    .volleyOffsetScale = volleyOffsetScale,
 };
 
 const MELShootingStyleClass * _Nonnull SinusShootingStyleGetClass(void) {
@@ -29,22 +34,33 @@ void SinusShootingStyleInit(MELShootingStyle * _Nonnull self, const MELShootingS
         .class = &SinusShootingStyleClass,
         .definition = definition,
         .shootInterval = MELRandomFloat(definition->shootInterval),
-        .bulletAmount = definition->bulletAmount,
+        .bulletAmount = MELShootingStyleClampBulletAmount(definition->bulletAmount),
         .bulletAmountVariation = definition->bulletAmountVariation,
         .inversionInterval = definition->inversionInterval,
     };
 }
 
-static void createBullets(MELShootingStyle * _Nonnull self, MELPoint origin, float angle, float initialDelta) {
+static void compile(const MELShootingStyle * _Nonnull self, MELBulletPattern * _Nonnull pattern) {
     const MELShootingStyleDefinition *definition = self->definition;
-    unsigned int time = playdate->system->getCurrentTimeMilliseconds();
-    const float progress = sinf((time * definition->speeds.x) / (1000.0f));
-    BulletConstructor(definition,
-                      MELPointAdd(origin, MELPointMake(progress * definition->space, 0.0f)),
-                      MELPointMake(0.0f, definition->speeds.y * definition->bulletSpeed),
-                      initialDelta);
-    BulletConstructor(definition,
-                      MELPointAdd(origin, MELPointMake(-progress * definition->space, 0.0f)),
-                      MELPointMake(0.0f, definition->speeds.y * definition->bulletSpeed),
-                      initialDelta);
+    const float speed = definition->speeds.y * definition->bulletSpeed;
+    const float space = definition->space;
+    MELBulletPatternPush(pattern, (MELBulletEmission) {
+        .direction = MELPointMake(0.0f, 1.0f),
+        .speed = speed,
+        .offset = MELPointMake(space, 0.0f),
+    });
+    MELBulletPatternPush(pattern, (MELBulletEmission) {
+        .direction = MELPointMake(0.0f, 1.0f),
+        .speed = speed,
+        .offset = MELPointMake(-space, 0.0f),
+    });
+}
+
+static float volleyAngle(MELShootingStyle * _Nonnull self, MELPoint origin, float angle) {
+    // Les tirs sont toujours verticaux.
+    return 0.0f;
+}
+
+static float volleyOffsetScale(MELShootingStyle * _Nonnull self, MELTimeInterval time) {
+    return MELTrigTableSin(time * self->definition->speeds.x);
 }
@@ -0,0 +1,165 @@
+//
+//  slotmap.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef slotmap_h
+#define slotmap_h
+
+#include "melstd.h"
+
+#include "list.h"
+
+/**
+ * Poignée vers une valeur d'une slot map.
+ *
+ * Les 16 bits de poids faible donnent l'emplacement, les 16 bits de poids fort sa génération.
+ * Une poignée dont la valeur a été retirée n'est plus valide, même si l'emplacement est réutilisé.
+ */
+typedef uint32_t MELHandle;
+
+/// Poignée ne désignant aucune valeur.
+#define MELHandleNull 0
+
+/// Nombre maximal de valeurs dans une slot map.
+#define MELSlotMapMaximumCount 0xFFFF
+
+#define MELHandleMake(slot, generation) (((uint32_t) (generation) << 16) | (slot))
+#define MELHandleGetSlot(handle) ((handle) & 0xFFFF)
+#define MELHandleGetGeneration(handle) ((handle) >> 16)
+
+typedef struct {
+    /// Impaire quand l'emplacement est occupé, paire quand il est libre.
+    uint16_t generation;
+    /// Index de la valeur dans `values` si l'emplacement est occupé, emplacement libre suivant + 1 sinon.
+    uint16_t index;
+} MELSlotMapSlot;
+
+// Definition macro
+
+/*
+ * Conteneur donnant une poignée générationnelle pour chaque valeur ajoutée.
+ * L'ajout, le retrait et l'accès par poignée sont en O(1). Les valeurs restent contiguës
+ * dans `values` et peuvent être parcourues comme une liste, dans un ordre quelconque.
+ */
+
+#define MELSlotMapDefine(type) /** Slot map of type */ typedef struct {\
+    /** Values, contiguous. Must not be modified directly. */\
+    type##List values;\
+    /** Slot of each value. Allocated with the same capacity as `values`. */\
+    uint16_t * _Nullable slotIndices;\
+    MELSlotMapSlot * _Nullable slots;\
+    unsigned int slotCount;\
+    unsigned int slotCapacity;\
+    /** First free slot + 1. 0 when every slot is used. */\
+    unsigned int freeSlot;\
+} type##SlotMap;\
+\
+extern const type##SlotMap type##SlotMapEmpty;\
+void type##SlotMapDeinit(type##SlotMap * _Nonnull self);\
+/** Grows the slot map so that it holds count values without any further allocation. */\
+void type##SlotMapReserve(type##SlotMap * _Nonnull self, unsigned int count);\
+MELHandle type##SlotMapInsert(type##SlotMap * _Nonnull self, type value);\
+/** Returns a pointer to the value of handle, or NULL if the value has been removed. The pointer is valid until the next insertion or removal. */\
+type * _Nullable type##SlotMapGet(const type##SlotMap * _Nonnull self, MELHandle handle);\
+MELBoolean type##SlotMapContains(const type##SlotMap * _Nonnull self, MELHandle handle);\
+MELBoolean type##SlotMapRemove(type##SlotMap * _Nonnull self, MELHandle handle);\
+/** Removes the value at the given index of `values`. The last value takes its place. */\
+void type##SlotMapRemoveAtIndex(type##SlotMap * _Nonnull self, unsigned int index);\
+MELHandle type##SlotMapHandleAtIndex(const type##SlotMap * _Nonnull self, unsigned int index);
+
+// Implementation macro
+
+#define MELSlotMapImplement(type) const type##SlotMap type##SlotMapEmpty = {};\
+\
+void type##SlotMapDeinit(type##SlotMap * _Nonnull self) {\
+    type##ListDeinit(&self->values);\
+    playdate->system->realloc(self->slotIndices, 0);\
+    playdate->system->realloc(self->slots, 0);\
+    *self = type##SlotMapEmpty;\
+}\
+\
+void type##SlotMapReserve(type##SlotMap * _Nonnull self, unsigned int count) {\
+    if (count <= self->values.capacity) {\
+        return;\
+    }\
+    type##ListGrow(&self->values, count);\
+    self->slotIndices = playdate->system->realloc(self->slotIndices, sizeof(uint16_t) * count);\
+}\
+\
+MELHandle type##SlotMapInsert(type##SlotMap * _Nonnull self, type value) {\
+    unsigned int slotIndex;\
+    if (self->freeSlot) {\
+        slotIndex = self->freeSlot - 1;\
+        self->freeSlot = self->slots[slotIndex].index;\
+    } else {\
+        if (self->slotCount == MELSlotMapMaximumCount) {\
+            playdate->system->error("Slot map of " #type " is full (%u values)", self->slotCount);\
+            return MELHandleNull;\
+        }\
+        if (self->slotCount == self->slotCapacity) {\
+            const unsigned int newCapacity = MELListNextCapacity(self->slotCapacity);\
+            self->slots = playdate->system->realloc(self->slots, sizeof(MELSlotMapSlot) * newCapacity);\
+            self->slotCapacity = newCapacity;\
+        }\
+        slotIndex = self->slotCount++;\
+        self->slots[slotIndex].generation = 0;\
+    }\
+    const unsigned int index = self->values.count;\
+    if (index == self->values.capacity) {\
+        type##SlotMapReserve(self, MELListNextCapacity(index));\
+    }\
+    self->values.memory[index] = value;\
+    self->values.count = index + 1;\
+    self->slotIndices[index] = slotIndex;\
+    MELSlotMapSlot *slot = self->slots + slotIndex;\
+    slot->generation++;\
+    slot->index = index;\
+    return MELHandleMake(slotIndex, slot->generation);\
+}\
+\
+type * _Nullable type##SlotMapGet(const type##SlotMap * _Nonnull self, MELHandle handle) {\
+    const unsigned int slotIndex = MELHandleGetSlot(handle);\
+    if (slotIndex >= self->slotCount) {\
+        return NULL;\
+    }\
+    const MELSlotMapSlot slot = self->slots[slotIndex];\
+    return (slot.generation & 1) && slot.generation == MELHandleGetGeneration(handle)\
+        ? self->values.memory + slot.index\
+        : NULL;\
+}\
+\
+MELBoolean type##SlotMapContains(const type##SlotMap * _Nonnull self, MELHandle handle) {\
+    return type##SlotMapGet(self, handle) != NULL;\
+}\
+\
+MELBoolean type##SlotMapRemove(type##SlotMap * _Nonnull self, MELHandle handle) {\
+    if (!type##SlotMapContains(self, handle)) {\
+        return false;\
+    }\
+    type##SlotMapRemoveAtIndex(self, self->slots[MELHandleGetSlot(handle)].index);\
+    return true;\
+}\
+\
+void type##SlotMapRemoveAtIndex(type##SlotMap * _Nonnull self, unsigned int index) {\
+    const unsigned int slotIndex = self->slotIndices[index];\
+    const unsigned int last = --self->values.count;\
+    if (index != last) {\
+        self->values.memory[index] = self->values.memory[last];\
+        self->slotIndices[index] = self->slotIndices[last];\
+        self->slots[self->slotIndices[index]].index = index;\
+    }\
+    MELSlotMapSlot *slot = self->slots + slotIndex;\
+    slot->generation++;\
+    slot->index = self->freeSlot;\
+    self->freeSlot = slotIndex + 1;\
+}\
+\
+MELHandle type##SlotMapHandleAtIndex(const type##SlotMap * _Nonnull self, unsigned int index) {\
+    const unsigned int slotIndex = self->slotIndices[index];\
+    return MELHandleMake(slotIndex, self->slots[slotIndex].generation);\
+}
+
+#endif /* slotmap_h */
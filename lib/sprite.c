@@ -11,6 +11,8 @@
 #include "simplespritehitbox.h"
 #include "melmath.h"
 #include "scene.h"
+#include "collisionworld.h"
+#include "spritebatch.h"
 #include "camera.h"
 #include "../src/gamescene.h"
 #include "../src/classes.h"
@@ -99,13 +101,18 @@ void MELSpriteDealloc(LCDSprite * _Nonnull sprite) {
     MELScene *scene = MELSceneGetCurrent();
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
     playdate->system->logToConsole("MELSpriteDealloc(%x, %x): %d", sprite, self, self->definition.name);
-    int index = LCDSpriteRefListRemoveSwapEntry(&scene->sprites, sprite);
-    if (index < 0) {
-        playdate->system->logToConsole("LCDSpriteRefListRemoveSwapEntry: sprite %x not found (%d)", sprite, index);
+    if (!MELSceneRemoveSprite(scene, sprite)) {
+        playdate->system->logToConsole("MELSceneRemoveSprite: sprite %x not found", sprite);
     }
 #else
-    LCDSpriteRefListRemoveSwapEntry(&scene->sprites, sprite);
+    MELSceneRemoveSprite(scene, sprite);
 #endif
+    if (scene->collisionWorld) {
+        MELCollisionWorldRemoveSprite(scene->collisionWorld, sprite);
+    }
+    if (self->spriteBatchIndex && scene->spriteBatch) {
+        MELSpriteBatchRemoveSprite(scene->spriteBatch, sprite);
+    }
     MELAnimationDealloc(self->animation);
     self->animation = NULL;
     if (self->hitbox != NULL) {
@@ -139,13 +146,14 @@ void MELSpriteUpdate(LCDSprite * _Nonnull sprite) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
     MELAnimation *animation = self->animation;
     MELAnimationUpdate(animation, DELTA);
+    MELHitboxInvalidate(self->hitbox);
 
     const MELSpritePositionFixed fixed = self->fixed;
     const MELPoint origin = self->frame.origin;
     const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, animation->frame.atlasIndex), MELDirectionFlip[self->direction]);
+    MELSpritePushPosition(self, sprite, x, y);
+    MELSpritePushImage(self, sprite, MELDirectionFlip[self->direction]);
 }
 
 /// Déplace, gère l'animation et affiche un effet de collision pour le `MELSprite` donné.
@@ -154,12 +162,43 @@ void MELSpriteDraw(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite) {
     MELAnimationUpdate(animation, DELTA);
 
     const MELPoint origin = self->frame.origin;
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(origin));
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, animation->frame.atlasIndex), kBitmapUnflipped);
+    MELSpritePushPosition(self, sprite, origin.x, origin.y);
+    MELSpritePushImage(self, sprite, kBitmapUnflipped);
 
     MELSpriteChangeDrawModeWhenHit(self, sprite);
 }
 
+void MELSpritePushPosition(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, float x, float y) {
+    MELSpritePushScreenPosition(self, sprite, MOVETO_XY(x, y));
+}
+
+void MELSpritePushScreenPosition(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, float x, float y) {
+    MELSpritePushedState *pushedState = &self->pushedState;
+    if (!pushedState->hasPosition || pushedState->position.x != x || pushedState->position.y != y) {
+        playdate->sprite->moveTo(sprite, x, y);
+        pushedState->position = MELPointMake(x, y);
+        pushedState->hasPosition = true;
+    }
+}
+
+void MELSpritePushImage(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, LCDBitmapFlip flip) {
+    MELSpritePushedState *pushedState = &self->pushedState;
+    LCDBitmapTable *palette = self->definition.palette;
+    const int atlasIndex = self->animation->frame.atlasIndex;
+    if (!pushedState->hasImage || pushedState->palette != palette || pushedState->atlasIndex != atlasIndex || pushedState->flip != flip) {
+        playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(palette, atlasIndex), flip);
+        pushedState->palette = palette;
+        pushedState->atlasIndex = atlasIndex;
+        pushedState->flip = flip;
+        pushedState->hasImage = true;
+    }
+}
+
+void MELSpriteInvalidatePushedState(MELSprite * _Nonnull self) {
+    self->pushedState.hasPosition = false;
+    self->pushedState.hasImage = false;
+}
+
 void MELSpriteChangeDrawModeWhenHit(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite) {
     const float hitTimer = MELFloatMax(self->hitTimer - DELTA, 0.0f);
     const LCDBitmapDrawMode drawMode = (int)(hitTimer * 20.0f) % 2 ? kDrawModeFillBlack : kDrawModeCopy;
@@ -177,6 +216,7 @@ void MELSpriteSetAnimationAndDirection(MELSprite * _Nonnull self, AnimationName
         self->animationDirection = direction;
         MELAnimationDealloc(currentAnimation);
         self->animation = MELSpriteDefinitionGetAnimation(self->definition, animationName, direction);
+        MELHitboxInvalidate(self->hitbox);
     }
 }
 
@@ -188,15 +228,18 @@ void MELSpriteSetLeft(MELSprite * _Nonnull self, float left) {
     MELRectangle frame = self->frame;
     frame.origin.x = left + frame.size.width / 2.0f;
     self->frame = frame;
+    MELHitboxInvalidate(self->hitbox);
 }
 
 void MELSpriteSetRight(MELSprite * _Nonnull self, float right) {
     MELRectangle frame = self->frame;
     frame.origin.x = right - frame.size.width / 2.0f;
     self->frame = frame;
+    MELHitboxInvalidate(self->hitbox);
 }
 void MELSpriteMoveBy(MELSprite * _Nonnull self, MELPoint translation) {
     self->frame.origin = MELPointAdd(self->frame.origin, translation);
+    MELHitboxInvalidate(self->hitbox);
 }
 
 void MELSpriteSetPositionFixed(MELSprite * _Nonnull self, MELSpritePositionFixed fixed) {
@@ -217,14 +260,16 @@ void MELSpriteUpdateDisappearing(LCDSprite * _Nonnull sprite) {
     const MELPoint origin = self->frame.origin;
     const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
-
-    MELAnimationFrame frame = self->animation->frame;
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, frame.atlasIndex), MELDirectionFlip[self->direction]);
+    MELSpritePushPosition(self, sprite, x, y);
+    MELSpritePushImage(self, sprite, MELDirectionFlip[self->direction]);
 }
 
 void MELSpriteMakeDisappear(LCDSprite * _Nonnull sprite) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
+    if (self->spriteBatchIndex && MELSceneGetCurrent()->spriteBatch) {
+        // La fonction update du sprite doit être appelée pour qu'il disparaisse.
+        MELSpriteBatchRemoveSprite(MELSceneGetCurrent()->spriteBatch, sprite);
+    }
 
     if (self->definition.animations[AnimationNameDisappear * MELAnimationDirectionCount + MELAnimationDirectionRight] == NULL) {
         playdate->sprite->setUpdateFunction(sprite, self->class->destroy);
@@ -235,14 +280,14 @@ void MELSpriteMakeDisappear(LCDSprite * _Nonnull sprite) {
 #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
     playdate->system->logToConsole("MELSpriteMakeDisappear(%x, %x): %d", sprite, self, self->definition.name);
 #endif
-    MELScene *scene = MELSceneGetCurrent();
-    LCDSpriteRefListRemoveSwapEntry(&scene->sprites, sprite);
+    MELSceneRemoveSprite(MELSceneGetCurrent(), sprite);
     MELSpriteInstance *instance = self->instance;
     if (instance) {
         instance->destroyed = true;
     }
 
     self->definition.type = MELSpriteTypeDecor;
+    self->definition.collisionCategory = 0;
     MELSpriteSetAnimation(self, AnimationNameDisappear);
     playdate->sprite->setUpdateFunction(sprite, MELSpriteUpdateDisappearing);
 }
@@ -405,12 +450,14 @@ MELRectangle LCDSpriteSetFrame(LCDSprite * _Nonnull sprite, MELRectangle frame)
     MELSprite *self = playdate->sprite->getUserdata(sprite);
     const MELRectangle oldFrame = self->frame;
     self->frame = frame;
+    MELHitboxInvalidate(self->hitbox);
     return oldFrame;
 }
 MELPoint LCDSpriteSetOrigin(LCDSprite * _Nonnull sprite, MELPoint origin) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
     const MELPoint oldOrigin = self->frame.origin;
     self->frame.origin = origin;
+    MELHitboxInvalidate(self->hitbox);
     return oldOrigin;
 }
 void LCDSpriteMoveBy(LCDSprite * _Nonnull sprite, MELPoint translation) {
@@ -421,16 +468,17 @@ void LCDSpriteMoveBy(LCDSprite * _Nonnull sprite, MELPoint translation) {
     const MELPoint origin = self->frame.origin;
     const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
+    MELSpritePushPosition(self, sprite, x, y);
 }
 void LCDSpriteMoveTo(LCDSprite * _Nonnull sprite, MELPoint destination) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
     self->frame.origin = destination;
+    MELHitboxInvalidate(self->hitbox);
 
     const MELSpritePositionFixed fixed = self->fixed;
     const float x = (fixed & MELSpritePositionFixedX) ? destination.x : destination.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? destination.y : destination.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, MOVETO_XY(x, y));
+    MELSpritePushPosition(self, sprite, x, y);
 }
 void LCDSpriteSetClass(LCDSprite * _Nonnull sprite, const MELSpriteClass * _Nonnull class) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
@@ -446,4 +494,5 @@ const MELSpriteClass MELSpriteClassDefault = (MELSpriteClass) {
     .name = SpriteClassNameDefault,
     .destroy = MELSpriteDealloc,
     .update = MELSpriteUpdate,
+    .cullingPolicy = MELSpriteCullingPolicySleep,
 };
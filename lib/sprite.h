@@ -33,14 +33,43 @@
 
 typedef struct mellayer MELLayer;
 
+/**
+ * Comportement d'un sprite lorsqu'il s'éloigne de la caméra.
+ */
+typedef enum {
+    /// Le sprite reste actif quelle que soit sa position.
+    MELSpriteCullingPolicyNone,
+    /// Le sprite est masqué mais continue d'être mis à jour.
+    MELSpriteCullingPolicyHide,
+    /// Le sprite est masqué et n'est plus mis à jour. Il reste dans la liste d'affichage du SDK.
+    MELSpriteCullingPolicyStopAnimating,
+    /// Le sprite est retiré de la liste d'affichage du SDK et ne participe plus aux collisions.
+    MELSpriteCullingPolicySleep,
+} MELSpriteCullingPolicy;
+
+typedef enum {
+    MELSpriteCullingStateAwake,
+    MELSpriteCullingStateHidden,
+    MELSpriteCullingStateStopped,
+    MELSpriteCullingStateAsleep,
+} MELSpriteCullingState;
+
 typedef struct melspriteclass {
     SpriteClassName name;
     void (* _Nonnull destroy)(LCDSprite * _Nonnull self);
     void (* _Nullable update)(LCDSprite * _Nonnull self);
     void (* _Nullable collidesWithPlayer)(LCDSprite * _Nonnull self, LCDSprite * _Nonnull player);
 
+    // Évènements envoyés par MELCollisionWorldUpdate.
+    void (* _Nullable collisionEnter)(LCDSprite * _Nonnull self, LCDSprite * _Nonnull other);
+    void (* _Nullable collisionStay)(LCDSprite * _Nonnull self, LCDSprite * _Nonnull other);
+    void (* _Nullable collisionExit)(LCDSprite * _Nonnull self, LCDSprite * _Nonnull other);
+
     void (* _Nullable save)(MELSprite * _Nonnull self, MELOutputStream * _Nonnull outputStream);
     MELSprite * _Nullable (* _Nullable load)(MELSpriteDefinition * _Nonnull definition, LCDSprite * _Nonnull sprite, MELInputStream * _Nonnull inputStream);
+
+    /// Comportement appliqué par `MELSpriteCullingUpdate` lorsque le sprite est loin de la caméra.
+    MELSpriteCullingPolicy cullingPolicy;
 } MELSpriteClass;
 
 extern const MELSpriteClass MELSpriteClassDefault;
@@ -51,6 +80,29 @@ typedef enum {
     MELSpritePositionFixedBoth = 3,
 } MELSpritePositionFixed;
 
+/**
+ * Cellules d'une `MELGeoMap` occupées par un sprite.
+ */
+typedef struct {
+    MELIntRectangle cells;
+    /// Génération de la carte au moment de l'ajout. Le sprite n'est pas dans la carte si elle ne correspond plus.
+    uint32_t generation;
+} MELGeoMapLocation;
+
+/**
+ * Dernière position et dernière image envoyées au SDK.
+ */
+typedef struct {
+    /// Dernière position donnée à `moveTo`, après application de `MOVETO_XY`.
+    MELPoint position;
+    /// Table d'images de la dernière image donnée à `setImage`.
+    LCDBitmapTable * _Nullable palette;
+    int atlasIndex;
+    LCDBitmapFlip flip;
+    MELBoolean hasPosition;
+    MELBoolean hasImage;
+} MELSpritePushedState;
+
 typedef struct melsprite {
     const MELSpriteClass * _Nonnull class;
     MELSpriteDefinition definition;
@@ -75,6 +127,21 @@ typedef struct melsprite {
     // Permet de fixer la position x ou y par rapport à la caméra.
     MELSpritePositionFixed fixed;
     LCDBitmapDrawMode drawMode;
+
+    MELGeoMapLocation geoMapLocation;
+
+    /// Permet de ne pas rappeler `moveTo` et `setImage` lorsque rien n'a changé.
+    MELSpritePushedState pushedState;
+    /// Index + 1 du sprite dans le `MELSpriteBatch` de la scène. 0 si le sprite n'en fait pas partie.
+    unsigned int spriteBatchIndex;
+
+    /// Poignée du sprite dans les sprites de sa scène. `MELHandleNull` tant qu'il n'y a pas été ajouté.
+    MELHandle handle;
+
+    /// État appliqué par `MELSpriteCullingUpdate`.
+    MELSpriteCullingState cullingState;
+    /// Visibilité du sprite avant qu'il ne soit masqué par `MELSpriteCullingUpdate`.
+    MELBoolean wasVisibleBeforeCulling;
 } MELSprite;
 
 /**
@@ -131,6 +198,43 @@ void MELSpriteUpdate(LCDSprite * _Nonnull sprite);
 void MELSpriteUpdateDisappearing(LCDSprite * _Nonnull sprite);
 
 void MELSpriteDraw(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Déplace le `LCDSprite` à la position donnée, sauf s'il y est déjà.
+ *
+ * @param self Sprite.
+ * @param sprite `LCDSprite` du sprite.
+ * @param x Abscisse à l'écran.
+ * @param y Ordonnée à l'écran.
+ */
+void MELSpritePushPosition(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, float x, float y);
+
+/**
+ * Déplace le `LCDSprite` à la position donnée, sauf s'il y est déjà.
+ * Contrairement à `MELSpritePushPosition`, la position est donnée telle quelle à `moveTo`, sans `MOVETO_XY`.
+ *
+ * @param self Sprite.
+ * @param sprite `LCDSprite` du sprite.
+ * @param x Abscisse dans le repère du SDK.
+ * @param y Ordonnée dans le repère du SDK.
+ */
+void MELSpritePushScreenPosition(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, float x, float y);
+
+/**
+ * Affiche l'image de la frame courante de l'animation du sprite, sauf si elle est déjà affichée avec le même retournement.
+ *
+ * @param self Sprite.
+ * @param sprite `LCDSprite` du sprite.
+ * @param flip Retournement de l'image.
+ */
+void MELSpritePushImage(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite, LCDBitmapFlip flip);
+
+/**
+ * Force le prochain appel à `MELSpritePushPosition` et à `MELSpritePushImage` à appeler le SDK.
+ * À utiliser après un appel direct à `playdate->sprite->moveTo` ou `setImage`.
+ */
+void MELSpriteInvalidatePushedState(MELSprite * _Nonnull self);
+
 void MELSpriteChangeDrawModeWhenHit(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite);
 
 void MELSpriteSave(LCDSprite * _Nonnull sprite, MELOutputStream * _Nonnull outputStream);
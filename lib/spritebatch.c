@@ -0,0 +1,94 @@
+//
+//  spritebatch.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "spritebatch.h"
+
+#include "camera.h"
+#include "../src/common.h"
+
+MELListImplement(MELSpriteBatchEntry);
+
+MELSpriteBatch * _Nonnull MELSpriteBatchAlloc(void) {
+    MELSpriteBatch *self = playdate->system->realloc(NULL, sizeof(MELSpriteBatch));
+    *self = (MELSpriteBatch) {
+        .entries = MELSpriteBatchEntryListMake(),
+    };
+    return self;
+}
+
+void MELSpriteBatchDealloc(MELSpriteBatch * _Nonnull self) {
+    MELSpriteBatchEntryList entries = self->entries;
+    for (unsigned int index = 0; index < entries.count; index++) {
+        entries.memory[index].melSprite->spriteBatchIndex = 0;
+    }
+    MELSpriteBatchEntryListDeinit(&self->entries);
+    playdate->system->realloc(self, 0);
+}
+
+void MELSpriteBatchAddSprite(MELSpriteBatch * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    if (melSprite->spriteBatchIndex) {
+        return;
+    }
+    MELSpriteBatchEntryListPush(&self->entries, (MELSpriteBatchEntry) {
+        .melSprite = melSprite,
+        .sprite = sprite,
+    });
+    melSprite->spriteBatchIndex = self->entries.count;
+    playdate->sprite->setUpdatesEnabled(sprite, false);
+}
+
+void MELSpriteBatchRemoveSprite(MELSpriteBatch * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+    const unsigned int batchIndex = melSprite->spriteBatchIndex;
+    if (!batchIndex) {
+        return;
+    }
+    MELSpriteBatchEntryList *entries = &self->entries;
+    const unsigned int index = batchIndex - 1;
+    const unsigned int lastIndex = entries->count - 1;
+    if (index != lastIndex) {
+        const MELSpriteBatchEntry last = entries->memory[lastIndex];
+        entries->memory[index] = last;
+        last.melSprite->spriteBatchIndex = batchIndex;
+    }
+    entries->count = lastIndex;
+    melSprite->spriteBatchIndex = 0;
+    // Un sprite endormi par le culling doit le rester : c'est le réveil qui réactivera ses mises à jour.
+    if (melSprite->cullingState == MELSpriteCullingStateAwake) {
+        playdate->sprite->setUpdatesEnabled(sprite, true);
+    }
+}
+
+void MELSpriteBatchUpdate(MELSpriteBatch * _Nonnull self) {
+    const MELPoint cameraOrigin = camera.frame.origin;
+    const MELTimeInterval delta = DELTA;
+    const MELSpriteBatchEntryList entries = self->entries;
+    for (unsigned int index = 0; index < entries.count; index++) {
+        const MELSpriteBatchEntry entry = entries.memory[index];
+        MELSprite *melSprite = entry.melSprite;
+        if (melSprite->cullingState >= MELSpriteCullingStateStopped) {
+            continue;
+        }
+
+        MELAnimation *animation = melSprite->animation;
+        if (animation->class->update != MELAnimationNoopUpdate) {
+            const int frameIndex = animation->frameIndex;
+            animation->class->update(animation, delta);
+            if (animation->frameIndex != frameIndex) {
+                MELHitboxInvalidate(melSprite->hitbox);
+            }
+        }
+
+        const MELSpritePositionFixed fixed = melSprite->fixed;
+        const MELPoint origin = melSprite->frame.origin;
+        const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - cameraOrigin.x;
+        const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - cameraOrigin.y;
+        MELSpritePushPosition(melSprite, entry.sprite, x, y);
+        MELSpritePushImage(melSprite, entry.sprite, MELDirectionFlip[melSprite->direction]);
+    }
+}
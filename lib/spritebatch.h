@@ -0,0 +1,55 @@
+//
+//  spritebatch.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef spritebatch_h
+#define spritebatch_h
+
+#include "melstd.h"
+
+#include "sprite.h"
+#include "list.h"
+
+typedef struct {
+    MELSprite * _Nonnull melSprite;
+    LCDSprite * _Nonnull sprite;
+} MELSpriteBatchEntry;
+
+MELListDefine(MELSpriteBatchEntry);
+
+/**
+ * Lot de sprites mis à jour par la scène plutôt que par le SDK.
+ *
+ * Les sprites du lot ont le comportement de `MELSpriteUpdate` : leur animation est mise à jour et ils suivent la caméra.
+ * Le SDK n'appelle plus leur fonction update : `moveTo` et `setImage` ne sont appelés que si la position à l'écran
+ * ou l'image a changé.
+ */
+typedef struct melspritebatch {
+    MELSpriteBatchEntryList entries;
+} MELSpriteBatch;
+
+MELSpriteBatch * _Nonnull MELSpriteBatchAlloc(void);
+void MELSpriteBatchDealloc(MELSpriteBatch * _Nonnull self);
+
+/**
+ * Ajoute le sprite donné au lot et désactive l'appel de sa fonction update par le SDK.
+ * Ne fait rien si le sprite est déjà dans un lot.
+ */
+void MELSpriteBatchAddSprite(MELSpriteBatch * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Retire le sprite donné du lot et réactive l'appel de sa fonction update par le SDK.
+ * Appelé par `MELSpriteDealloc` et `MELSpriteMakeDisappear`.
+ */
+void MELSpriteBatchRemoveSprite(MELSpriteBatch * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+/**
+ * Met à jour les animations et les positions à l'écran de tous les sprites du lot.
+ * À appeler dans la fonction update de la scène, avant `playdate->sprite->updateAndDrawSprites()`.
+ */
+void MELSpriteBatchUpdate(MELSpriteBatch * _Nonnull self);
+
+#endif /* spritebatch_h */
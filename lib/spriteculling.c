@@ -0,0 +1,100 @@
+//
+//  spriteculling.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "spriteculling.h"
+
+#include "camera.h"
+#include "melmath.h"
+
+const MELSpriteCulling MELSpriteCullingDefault = {
+    .cullDistance = 64.0f,
+    .wakeDistance = 32.0f,
+};
+
+static float distanceToCamera(MELSprite * _Nonnull self, MELRectangle cameraFrame);
+static void cull(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite);
+static void wake(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite);
+
+void MELSpriteCullingUpdate(MELSpriteCulling self, LCDSpriteRefList sprites) {
+    const MELRectangle cameraFrame = camera.frame;
+    for (unsigned int index = 0; index < sprites.count; index++) {
+        LCDSprite *sprite = sprites.memory[index];
+        MELSprite *melSprite = playdate->sprite->getUserdata(sprite);
+        if (melSprite->class->cullingPolicy == MELSpriteCullingPolicyNone || melSprite->fixed) {
+            continue;
+        }
+        const float distance = distanceToCamera(melSprite, cameraFrame);
+        if (melSprite->cullingState == MELSpriteCullingStateAwake) {
+            if (distance > self.cullDistance) {
+                cull(melSprite, sprite);
+            }
+        } else if (distance <= self.wakeDistance) {
+            wake(melSprite, sprite);
+        }
+    }
+}
+
+void MELSpriteCullingWake(LCDSprite * _Nonnull sprite) {
+    MELSprite *self = playdate->sprite->getUserdata(sprite);
+    if (self->cullingState != MELSpriteCullingStateAwake) {
+        wake(self, sprite);
+    }
+}
+
+static float distanceToCamera(MELSprite * _Nonnull self, MELRectangle cameraFrame) {
+    const MELRectangle frame = self->frame;
+    const float halfWidth = frame.size.width / 2.0f;
+    const float halfHeight = frame.size.height / 2.0f;
+    const float horizontalDistance = MELFloatMax(
+        MELFloatMax(cameraFrame.origin.x - (frame.origin.x + halfWidth), (frame.origin.x - halfWidth) - (cameraFrame.origin.x + cameraFrame.size.width)),
+        0.0f);
+    const float verticalDistance = MELFloatMax(
+        MELFloatMax(cameraFrame.origin.y - (frame.origin.y + halfHeight), (frame.origin.y - halfHeight) - (cameraFrame.origin.y + cameraFrame.size.height)),
+        0.0f);
+    return MELFloatMax(horizontalDistance, verticalDistance);
+}
+
+static void cull(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    switch (self->class->cullingPolicy) {
+        case MELSpriteCullingPolicyHide:
+            self->cullingState = MELSpriteCullingStateHidden;
+            self->wasVisibleBeforeCulling = playdate->sprite->isVisible(sprite);
+            playdate->sprite->setVisible(sprite, false);
+            break;
+        case MELSpriteCullingPolicyStopAnimating:
+            self->cullingState = MELSpriteCullingStateStopped;
+            self->wasVisibleBeforeCulling = playdate->sprite->isVisible(sprite);
+            playdate->sprite->setVisible(sprite, false);
+            playdate->sprite->setUpdatesEnabled(sprite, false);
+            break;
+        case MELSpriteCullingPolicySleep:
+            self->cullingState = MELSpriteCullingStateAsleep;
+            playdate->sprite->removeSprite(sprite);
+            break;
+        default:
+            break;
+    }
+}
+
+static void wake(MELSprite * _Nonnull self, LCDSprite * _Nonnull sprite) {
+    switch (self->cullingState) {
+        case MELSpriteCullingStateHidden:
+            playdate->sprite->setVisible(sprite, self->wasVisibleBeforeCulling);
+            break;
+        case MELSpriteCullingStateStopped:
+            playdate->sprite->setVisible(sprite, self->wasVisibleBeforeCulling);
+            // Les sprites d'un MELSpriteBatch sont mis à jour par le lot.
+            playdate->sprite->setUpdatesEnabled(sprite, !self->spriteBatchIndex);
+            break;
+        case MELSpriteCullingStateAsleep:
+            playdate->sprite->addSprite(sprite);
+            break;
+        default:
+            break;
+    }
+    self->cullingState = MELSpriteCullingStateAwake;
+}
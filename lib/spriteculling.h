@@ -0,0 +1,51 @@
+//
+//  spriteculling.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef spriteculling_h
+#define spriteculling_h
+
+#include "melstd.h"
+
+#include "sprite.h"
+#include "lcdspriteref.h"
+
+/**
+ * Distances utilisées pour masquer ou mettre en veille les sprites éloignés de la caméra.
+ *
+ * Les distances sont mesurées entre le cadre du sprite et le cadre de la caméra.
+ * `wakeDistance` doit être inférieure à `cullDistance` pour éviter qu'un sprite à la limite
+ * ne change d'état à chaque frame.
+ */
+typedef struct {
+    /// Distance au delà de laquelle la politique de la classe du sprite est appliquée.
+    float cullDistance;
+    /// Distance en deçà de laquelle un sprite masqué ou en veille est réveillé.
+    float wakeDistance;
+} MELSpriteCulling;
+
+extern const MELSpriteCulling MELSpriteCullingDefault;
+
+/**
+ * Applique la politique `cullingPolicy` de leur classe aux sprites éloignés de la caméra
+ * et réveille ceux dont la caméra s'approche.
+ *
+ * Les sprites dont la position est fixe ne sont jamais masqués.
+ * À appeler dans la fonction update de la scène, après avoir déplacé la caméra.
+ *
+ * @param self Distances à utiliser.
+ * @param sprites Sprites de la scène.
+ */
+void MELSpriteCullingUpdate(MELSpriteCulling self, LCDSpriteRefList sprites);
+
+/**
+ * Réveille immédiatement le sprite donné, quelle que soit sa distance à la caméra.
+ *
+ * @param sprite Sprite à réveiller.
+ */
+void MELSpriteCullingWake(LCDSprite * _Nonnull sprite);
+
+#endif /* spriteculling_h */
@@ -8,6 +8,8 @@
 #include "spritedefinition.h"
 
 #include "noanimation.h"
+#include "bitmapmask.h"
+#include "particlesystem.h"
 
 MELAnimationDefinition * _Nullable MELSpriteDefinitionGetAnimationDefinition(MELSpriteDefinition self, unsigned int animationName, MELAnimationDirection direction) {
     MELAnimationDefinition *definition = self.animations[animationName * MELAnimationDirectionCount + direction];
@@ -17,6 +19,8 @@ MELAnimationDefinition * _Nullable MELSpriteDefinitionGetAnimationDefinition(MEL
 MELAnimation * _Nullable MELSpriteDefinitionGetAnimation(MELSpriteDefinition self, unsigned int animationName, MELAnimationDirection direction) {
     MELAnimationDefinition *definition = MELSpriteDefinitionGetAnimationDefinition(self, animationName, direction);
     if (definition != NULL) {
+        // Les définitions générées n'ont pas de diviseur : il est préparé à la création de leur première animation.
+        MELAnimationDefinitionPrepareDivider(definition);
         MELAnimation *animation = MELAnimationAlloc(definition);
         animation->class->start(animation);
         return animation;
@@ -25,8 +29,23 @@ MELAnimation * _Nullable MELSpriteDefinitionGetAnimation(MELSpriteDefinition sel
     }
 }
 
+uint16_t MELSpriteDefinitionGetCollisionCategory(const MELSpriteDefinition * _Nonnull self) {
+    return self->collisionCategory != 0 ? self->collisionCategory : MELSpriteTypeCollisionCategory(self->type);
+}
+
+uint16_t MELSpriteDefinitionGetCollisionMask(const MELSpriteDefinition * _Nonnull self) {
+    return self->collisionCategory != 0 ? self->collisionMask : MELSpriteTypeCollisionMask[self->type];
+}
+
+MELBoolean MELSpriteDefinitionCanCollideWith(const MELSpriteDefinition * _Nonnull self, const MELSpriteDefinition * _Nonnull other) {
+    return (MELSpriteDefinitionGetCollisionCategory(self) & MELSpriteDefinitionGetCollisionMask(other))
+        && (MELSpriteDefinitionGetCollisionCategory(other) & MELSpriteDefinitionGetCollisionMask(self));
+}
+
 void MELSpriteDefinitionFreePalette(MELSpriteDefinition * _Nonnull self) {
     if (self->palette) {
+        MELBitmapMaskClearCache();
+        MELParticleSystemRemovePalette(self->palette);
         playdate->graphics->freeBitmapTable(self->palette);
         self->palette = NULL;
     }
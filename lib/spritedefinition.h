@@ -34,12 +34,25 @@ typedef struct melspritedefinition {
     LCDBitmapTable * _Nullable palette;
     /// Taille MELAnimationDirectionCount * AnimationNameCount
     MELAnimationDefinition * _Nullable * _Nonnull animations;
+    /// Catégorie de collision. Si 0, la catégorie et le masque par défaut de `type` sont utilisés.
+    uint16_t collisionCategory;
+    /// Catégories avec lesquelles le sprite peut entrer en collision.
+    uint16_t collisionMask;
 } MELSpriteDefinition;
 
 MELAnimationDefinition * _Nullable MELSpriteDefinitionGetAnimationDefinition(MELSpriteDefinition self, unsigned int animationName, MELAnimationDirection direction);
 
 MELAnimation * _Nullable MELSpriteDefinitionGetAnimation(MELSpriteDefinition self, unsigned int animationName, MELAnimationDirection direction);
 
+uint16_t MELSpriteDefinitionGetCollisionCategory(const MELSpriteDefinition * _Nonnull self);
+uint16_t MELSpriteDefinitionGetCollisionMask(const MELSpriteDefinition * _Nonnull self);
+
+/**
+ * Indique si deux sprites de ces définitions peuvent entrer en collision.
+ * La catégorie de chacun doit être présente dans le masque de l'autre.
+ */
+MELBoolean MELSpriteDefinitionCanCollideWith(const MELSpriteDefinition * _Nonnull self, const MELSpriteDefinition * _Nonnull other);
+
 void MELSpriteDefinitionFreePalette(MELSpriteDefinition * _Nonnull self);
 
 #endif /* constspritedefinition_h */
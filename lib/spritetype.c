@@ -0,0 +1,25 @@
+//
+//  spritetype.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "spritetype.h"
+
+#define C(type) MELSpriteTypeCollisionCategory(MELSpriteType##type)
+
+const uint16_t MELSpriteTypeCollisionMask[MELSpriteTypeCount] = {
+    [MELSpriteTypeDecor] = 0,
+    [MELSpriteTypePlayer] = C(Platform) | C(Bonus) | C(Destructible) | C(Enemy) | C(EnemyWithAttackHitbox) | C(Collidable) | C(Bullet),
+    [MELSpriteTypePlatform] = C(Player),
+    [MELSpriteTypeBonus] = C(Player),
+    [MELSpriteTypeDestructible] = C(Player) | C(Bullet),
+    [MELSpriteTypeEnemy] = C(Player) | C(Bullet),
+    [MELSpriteTypeEnemyWithAttackHitbox] = C(Player) | C(Bullet),
+    [MELSpriteTypeCollidable] = C(Player),
+    [MELSpriteTypeBullet] = C(Player) | C(Destructible) | C(Enemy) | C(EnemyWithAttackHitbox),
+    [MELSpriteTypeFont] = 0,
+};
+
+#undef C
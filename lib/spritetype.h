@@ -8,6 +8,8 @@
 #ifndef spritetype_h
 #define spritetype_h
 
+#include "melstd.h"
+
 typedef enum {
     MELSpriteTypeDecor,
     MELSpriteTypePlayer,
@@ -19,6 +21,13 @@ typedef enum {
     MELSpriteTypeCollidable,
     MELSpriteTypeBullet,
     MELSpriteTypeFont,
+    MELSpriteTypeCount,
 } MELSpriteType;
 
+/// Bit de catégorie de collision par défaut du type donné.
+#define MELSpriteTypeCollisionCategory(type) ((uint16_t) (1 << (type)))
+
+/// Masque de collision par défaut de chaque type : catégories avec lesquelles un sprite de ce type peut entrer en collision.
+extern const uint16_t MELSpriteTypeCollisionMask[MELSpriteTypeCount];
+
 #endif /* spritetype_h */
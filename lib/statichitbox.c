@@ -38,3 +38,8 @@ MELHitbox * _Nonnull MELStaticHitboxAlloc(MELRectangle frame) {
 MELHitbox * _Nonnull MELStaticHitboxLoad(MELInputStream * _Nonnull inputStream) {
     return MELStaticHitboxAlloc(MELInputStreamReadRectangle(inputStream));
 }
+
+void MELStaticHitboxSetFrame(MELHitbox * _Nonnull self, MELRectangle frame) {
+    ((MELStaticHitbox *)self)->frame = frame;
+    MELHitboxInvalidate(self);
+}
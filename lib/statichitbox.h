@@ -15,10 +15,12 @@ extern const MELHitboxClass MELStaticHitboxClass;
 
 typedef struct {
     MELHitbox super;
+    /// Position de la hitbox. À modifier avec `MELStaticHitboxSetFrame` pour invalider la boîte englobante.
     MELRectangle frame;
 } MELStaticHitbox;
 
 MELHitbox * _Nonnull MELStaticHitboxAlloc(MELRectangle frame);
 MELHitbox * _Nonnull MELStaticHitboxLoad(MELInputStream * _Nonnull inputStream);
+void MELStaticHitboxSetFrame(MELHitbox * _Nonnull self, MELRectangle frame);
 
 #endif /* statichitbox_h */
@@ -2,6 +2,7 @@
 
 #include "camera.h"
 #include "scene.h"
+#include "easingtable.h"
 
 typedef struct {
     void * _Nullable oldUserdata;
@@ -54,7 +55,7 @@ void MELStrideSpriteTo(LCDSprite * _Nonnull sprite, MELPoint to, float delay, fl
         },
         .delay = delay,
         .duration = delay + duration,
-        .easingFunction = MELEaseInOut,
+        .easingFunction = MELEaseInOutTabulated,
         .oldUserdata = self->userdata,
         .oldAutoReleaseUserdata = self->autoReleaseUserdata,
         .delegate = MELSpriteNoopUpdate,
@@ -98,6 +99,7 @@ void MELStrideTogetherAlignedRight(LCDSprite * _Nullable sprite, LCDSprite * _Nu
             .y = otherFrame.origin.y
         }
     };
+    MELHitboxInvalidate(self->hitbox);
     *selfStride = *otherStride;
     playdate->sprite->setUpdateFunction(sprite, MELStrideUpdate);
 }
@@ -114,6 +116,7 @@ void MELStrideSkip(LCDSprite * _Nullable sprite) {
         .y = stride->origin.y + stride->distance.height,
     };
     self->frame = frame;
+    MELHitboxInvalidate(self->hitbox);
     self->userdata = stride->oldUserdata;
     self->autoReleaseUserdata = stride->oldAutoReleaseUserdata;
 
@@ -121,7 +124,7 @@ void MELStrideSkip(LCDSprite * _Nullable sprite) {
     const MELPoint origin = frame.origin;
     const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
     const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-    playdate->sprite->moveTo(sprite, x, y);
+    MELSpritePushScreenPosition(self, sprite, x, y);
     playdate->sprite->setUpdateFunction(sprite, getUpdateFunction(stride, self->class));
     stride->delegate(sprite);
 
@@ -178,7 +181,8 @@ void MELStrideUpdate(LCDSprite * _Nonnull sprite) {
     MELAnimation *animation = self->animation;
     if (animation) {
         MELAnimationUpdate(animation, DELTA);
-        playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, animation->frame.atlasIndex), MELDirectionFlip[self->direction]);
+        MELHitboxInvalidate(self->hitbox);
+        MELSpritePushImage(self, sprite, MELDirectionFlip[self->direction]);
     }
 
     MELStride *stride = self->userdata;
@@ -195,12 +199,13 @@ void MELStrideUpdate(LCDSprite * _Nonnull sprite) {
         frame.origin.x = stride->origin.x + stride->distance.width * progress;
         frame.origin.y = stride->origin.y + stride->distance.height * progress;
         self->frame = frame;
+        MELHitboxInvalidate(self->hitbox);
 
         const MELSpritePositionFixed fixed = self->fixed;
         const MELPoint origin = frame.origin;
         const float x = (fixed & MELSpritePositionFixedX) ? origin.x : origin.x - camera.frame.origin.x;
         const float y = (fixed & MELSpritePositionFixedY) ? origin.y : origin.y - camera.frame.origin.y;
-        playdate->sprite->moveTo(sprite, x, y);
+        MELSpritePushScreenPosition(self, sprite, x, y);
         stride->delegate(sprite);
         return;
     }
@@ -260,7 +265,7 @@ void MELStrideCameraTo(MELPoint to, float delay, float duration) {
         },
         .delay = delay,
         .duration = delay + duration,
-        .easingFunction = MELEaseInOut,
+        .easingFunction = MELEaseInOutTabulated,
         .oldUserdata = self->userdata,
         .oldAutoReleaseUserdata = self->autoReleaseUserdata,
         .destroyWhenStrideEnds = true,
@@ -222,10 +222,11 @@ static void update(LCDSprite * _Nonnull sprite) {
     MELSprite *self = playdate->sprite->getUserdata(sprite);
     MELAnimation *animation = self->animation;
     MELAnimationUpdate(animation, DELTA);
+    MELHitboxInvalidate(self->hitbox);
 
     MELPoint origin = self->frame.origin;
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(origin));
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, animation->frame.atlasIndex), MELDirectionFlip[self->direction]);
+    MELSpritePushPosition(self, sprite, origin.x, origin.y);
+    MELSpritePushImage(self, sprite, MELDirectionFlip[self->direction]);
 }
 
 static void updateCollidable(LCDSprite * _Nonnull sprite) {
@@ -241,12 +242,12 @@ static void updateCollidable(LCDSprite * _Nonnull sprite) {
         self->super.hitPoints = 0;
         self->sprite = NULL;
 
-        ExplosionConstructor(self->super.frame.origin, AnimationNameStand);
+        ExplosionSpawn(self->super.frame.origin, AnimationNameStand);
 
     #if LOG_SPRITE_PUSH_AND_REMOVE_FROM_SCENE_SPRITES
         playdate->system->logToConsole("MELSubSprite#update(%x, %x) hitPoints <= 0: %d", sprite, self, self->super.definition.name);
     #endif
-        LCDSpriteRefListRemoveSwapEntry(&currentScene->sprites, sprite);
+        MELSceneRemoveSprite(currentScene, sprite);
         MELAnimationDealloc(self->super.animation);
         if (self->super.hitbox != NULL) {
             MELHitboxDeinit(self->super.hitbox);
@@ -262,10 +263,10 @@ static void updateCollidable(LCDSprite * _Nonnull sprite) {
     }
 
     const float delta = DELTA;
-    MELAnimation *animation = self->super.animation;
     MELAnimationUpdate(self->super.animation, delta);
+    MELHitboxInvalidate(self->super.hitbox);
 
     MELPoint origin = self->super.frame.origin;
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(origin));
-    playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->super.definition.palette, animation->frame.atlasIndex), MELDirectionFlip[self->super.direction]);
+    MELSpritePushPosition(&self->super, sprite, origin.x, origin.y);
+    MELSpritePushImage(&self->super, sprite, MELDirectionFlip[self->super.direction]);
 }
@@ -26,7 +26,14 @@ static void MELSynchronizedLoopingAnimationStart(MELAnimation * _Nonnull self) {
 static void MELSynchronizedLoopingAnimationUpdate(MELAnimation * _Nonnull self, MELTimeInterval timeSinceLastUpdate) {
     const MELTimeInterval timeSinceStart = (playdate->system->getCurrentTimeMilliseconds() - referenceDate) / 1000.0f;
     const MELTimeInterval framesPerSecond = MELAnimationFramesPerSecond((MELAnimation *)self);
-    MELAnimationSetFrameIndex(self, (int)(timeSinceStart * framesPerSecond) % self->definition->frameCount);
+    const int elapsedFrames = (int)(timeSinceStart * framesPerSecond);
+    const MELAnimationDefinition *definition = self->definition;
+    if (definition->frameCountDivider.divisor == (int32_t) definition->frameCount) {
+        MELAnimationSetFrameIndex(self, MELIntDividerModulo(&definition->frameCountDivider, elapsedFrames));
+    } else {
+        // Définition générée dont le diviseur n'a pas encore été préparé par MELSpriteDefinitionGetAnimation.
+        MELAnimationSetFrameIndex(self, elapsedFrames % definition->frameCount);
+    }
 }
 
 const MELAnimationClass MELSynchronizedLoopingAnimationClass = {
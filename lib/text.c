@@ -75,10 +75,12 @@ void MELTextSetWithLeading(LCDSprite * _Nullable sprite, LCDFont * _Nonnull font
     frame.size.width = newWidth;
     frame.size.height = newHeight;
     self->frame = frame;
+    MELHitboxInvalidate(self->hitbox);
 
     playdate->sprite->setImage(sprite, image, kBitmapUnflipped);
     playdate->sprite->setSize(sprite, newWidth, newHeight);
-    playdate->sprite->moveTo(sprite, MOVETO_POINT(frame.origin));
+    MELSpriteInvalidatePushedState(self);
+    MELSpritePushPosition(self, sprite, frame.origin.x, frame.origin.y);
     playdate->sprite->markDirty(sprite);
 }
 
@@ -0,0 +1,112 @@
+//
+//  trigtable.c
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#include "trigtable.h"
+
+#include "melmath.h"
+
+#define MEL_TRIG_TABLE_SIZE MELTRIGTABLE_SIZE
+#define MEL_TRIG_TABLE_MASK (MEL_TRIG_TABLE_SIZE - 1)
+#define MEL_ATAN_TABLE_SIZE (MELTRIGTABLE_SIZE / 2)
+#define MEL_2_PI_DOUBLE 6.28318530717958647692528676655900576
+
+#if (MEL_TRIG_TABLE_SIZE & MEL_TRIG_TABLE_MASK) || MEL_TRIG_TABLE_SIZE < 8
+#error "MELTRIGTABLE_SIZE must be a power of 2, at least 8."
+#endif
+
+/// sin(2π × index / MEL_TRIG_TABLE_SIZE). The last entry repeats the first one so that interpolation never wraps.
+static float sinTable[MEL_TRIG_TABLE_SIZE + 1];
+
+/// atan(index / MEL_ATAN_TABLE_SIZE), for ratios between 0 and 1.
+static float atanTable[MEL_ATAN_TABLE_SIZE + 1];
+
+static float sinFromTableUnits(float units);
+
+void MELTrigTableInit(void) {
+    // Computed in double precision so that each entry is the nearest float.
+    for (int index = 0; index < MEL_TRIG_TABLE_SIZE; index++) {
+        sinTable[index] = (float) sin(index * (MEL_2_PI_DOUBLE / MEL_TRIG_TABLE_SIZE));
+    }
+    sinTable[MEL_TRIG_TABLE_SIZE] = sinTable[0];
+    for (int index = 0; index <= MEL_ATAN_TABLE_SIZE; index++) {
+        atanTable[index] = (float) atan((double) index / MEL_ATAN_TABLE_SIZE);
+    }
+}
+
+float MELTrigTableSin(float angle) {
+#if MELTRIGTABLE_USE_LIBM
+    return sinf(angle);
+#else
+    return sinFromTableUnits(angle * (MEL_TRIG_TABLE_SIZE / MEL_2_PI));
+#endif
+}
+
+float MELTrigTableCos(float angle) {
+#if MELTRIGTABLE_USE_LIBM
+    return cosf(angle);
+#else
+    return sinFromTableUnits(angle * (MEL_TRIG_TABLE_SIZE / MEL_2_PI) + MEL_TRIG_TABLE_SIZE / 4);
+#endif
+}
+
+MELPoint MELTrigTableDirection(float angle) {
+#if MELTRIGTABLE_USE_LIBM
+    return MELPointMake(cosf(angle), sinf(angle));
+#else
+    const float units = angle * (MEL_TRIG_TABLE_SIZE / MEL_2_PI);
+    return MELPointMake(sinFromTableUnits(units + MEL_TRIG_TABLE_SIZE / 4), sinFromTableUnits(units));
+#endif
+}
+
+float MELTrigTableAtan2(float y, float x) {
+#if MELTRIGTABLE_USE_LIBM
+    return atan2f(y, x);
+#else
+    const float absX = fabsf(x);
+    const float absY = fabsf(y);
+    if (absX == 0.0f && absY == 0.0f) {
+        return 0.0f;
+    }
+
+    // Reduces to the first octant so that the ratio stays between 0 and 1.
+    const MELBoolean swap = absY > absX;
+    const float units = (swap ? absX / absY : absY / absX) * MEL_ATAN_TABLE_SIZE;
+    const int index = MELIntMin((int) units, MEL_ATAN_TABLE_SIZE - 1);
+    const float from = atanTable[index];
+    float angle = from + (atanTable[index + 1] - from) * (units - index);
+
+    if (swap) {
+        angle = MEL_PI_2 - angle;
+    }
+    if (x < 0.0f) {
+        angle = MEL_PI - angle;
+    }
+    return y < 0.0f ? -angle : angle;
+#endif
+}
+
+static float sinFromTableUnits(float units) {
+    const float floored = floorf(units);
+    const int index = ((int) floored) & MEL_TRIG_TABLE_MASK;
+    const float ratio = units - floored;
+    const float from = sinTable[index];
+    return from + (sinTable[index + 1] - from) * ratio;
+}
+
+MELTrigTableError MELTrigTableMeasureError(unsigned int sampleCount) {
+    MELTrigTableError error = {};
+    for (unsigned int sample = 0; sample < sampleCount; sample++) {
+        // Two turns, starting below 0, to go through negative angles and the wrap-around of the table.
+        const float angle = -MEL_2_PI + 2 * MEL_2_PI * sample / sampleCount;
+        error.sin = MELFloatMax(error.sin, fabsf(MELTrigTableSin(angle) - sinf(angle)));
+        error.cos = MELFloatMax(error.cos, fabsf(MELTrigTableCos(angle) - cosf(angle)));
+
+        const MELPoint direction = MELPointMake(cosf(angle), sinf(angle));
+        error.atan2 = MELFloatMax(error.atan2, fabsf(MELTrigTableAtan2(direction.y, direction.x) - atan2f(direction.y, direction.x)));
+    }
+    return error;
+}
@@ -0,0 +1,85 @@
+//
+//  trigtable.h
+//  Roll
+//
+//  Created by Raphaël Calabro on 19/10/2026.
+//
+
+#ifndef trigtable_h
+#define trigtable_h
+
+#include "melstd.h"
+
+#include "point.h"
+
+/*
+ * Tables are used unless MELTRIGTABLE_USE_LIBM is set in melstd.h. Call sites
+ * needing the full precision of libm can also keep calling sinf, cosf and atan2f directly.
+ *
+ * The sine table has MELTRIGTABLE_SIZE entries per turn and the arctangent table half as many.
+ * The errors given below are for the default size of 256.
+ */
+
+/**
+ * Maximum absolute errors measured against libm.
+ */
+typedef struct {
+    float sin;
+    float cos;
+    float atan2;
+} MELTrigTableError;
+
+/**
+ * @brief Fills the tables. Must be called once before any other function of this file.
+ */
+void MELTrigTableInit(void);
+
+/**
+ * @brief Returns the sine of the given angle, read from a precomputed table with linear interpolation.
+ *
+ * The maximum error is about 7.5e-5, which is enough for motion and effects.
+ *
+ * @param angle Angle in radians. Any value is accepted.
+ * @return The sine of angle.
+ */
+float MELTrigTableSin(float angle);
+
+/**
+ * @brief Returns the cosine of the given angle, read from a precomputed table with linear interpolation.
+ *
+ * @param angle Angle in radians. Any value is accepted.
+ * @return The cosine of angle.
+ */
+float MELTrigTableCos(float angle);
+
+/**
+ * @brief Returns the unit vector pointing toward the given angle.
+ *
+ * @param angle Angle in radians.
+ * @return (cos(angle), sin(angle)).
+ */
+MELPoint MELTrigTableDirection(float angle);
+
+/**
+ * @brief Returns the angle of the vector (x, y), read from a precomputed arctangent table with linear interpolation.
+ *
+ * The maximum error is about 1e-5 radian.
+ *
+ * @param y Vertical component.
+ * @param x Horizontal component.
+ * @return The angle in radians, between -π and π. Returns 0 when both components are 0.
+ */
+float MELTrigTableAtan2(float y, float x);
+
+/**
+ * @brief Compares the table functions with libm for angles evenly spread over two turns.
+ *
+ * Does not depend on the Playdate API and can be run on the host after `MELTrigTableInit`
+ * to check the accuracy of a new MELTRIGTABLE_SIZE.
+ *
+ * @param sampleCount Number of angles to test.
+ * @return The maximum absolute error of each function.
+ */
+MELTrigTableError MELTrigTableMeasureError(unsigned int sampleCount);
+
+#endif /* trigtable_h */
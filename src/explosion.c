@@ -35,10 +35,20 @@ LCDSprite * _Nonnull ExplosionConstructorWithDefinition(MELPoint origin, MELSpri
     playdate->sprite->setZIndex(sprite, ZINDEX_EXPLOSIONS);
     // NOTE: Les explosions ne sont pas ajoutées aux sprites de la scène courante pour éviter les problèmes à la détection des collisions.
     // Faire une map de points pour trouver les ennemis proches et simplifier les collisions.
-    LCDSpriteRefListPush(&currentScene->sprites, sprite);
+    self->handle = LCDSpriteRefSlotMapInsert(&currentScene->sprites, sprite);
     return sprite;
 }
 
+void ExplosionSpawn(MELPoint origin, AnimationName animationName) {
+    MELParticleSystem *particleSystem = currentScene->particleSystem;
+    if (particleSystem) {
+        loadSpriteExplosionPalette();
+        MELParticleSystemEmitOne(particleSystem, &spriteExplosion, animationName, origin);
+    } else {
+        ExplosionConstructor(origin, animationName);
+    }
+}
+
 const MELSpriteClass * _Nonnull ExplosionGetClass(void) {
     return &ExplosionClass;
 }
@@ -65,7 +75,7 @@ static void update(LCDSprite * _Nonnull sprite) {
         MELAnimationUpdate(animation, DELTA);
 
         MELPoint origin = self->frame.origin;
-        playdate->sprite->moveTo(sprite, origin.x, origin.y);
-        playdate->sprite->setImage(sprite, playdate->graphics->getTableBitmap(self->definition.palette, animation->frame.atlasIndex), kBitmapUnflipped);
+        MELSpritePushScreenPosition(self, sprite, origin.x, origin.y);
+        MELSpritePushImage(self, sprite, kBitmapUnflipped);
     }
 }
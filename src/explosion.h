@@ -15,4 +15,13 @@ LCDSprite * _Nonnull ExplosionConstructor(MELPoint origin, AnimationName animati
 LCDSprite * _Nonnull ExplosionConstructorWithDefinition(MELPoint origin, MELSpriteDefinition * _Nonnull definition, AnimationName animationName);
 const MELSpriteClass * _Nonnull ExplosionGetClass(void);
 
+/**
+ * Affiche une explosion. Utilise le système de particules de la scène courante s'il y en a un,
+ * sinon crée un sprite avec `ExplosionConstructor`.
+ *
+ * @param origin Centre de l'explosion.
+ * @param animationName Nom de l'animation à jouer.
+ */
+void ExplosionSpawn(MELPoint origin, AnimationName animationName);
+
 #endif /* explosion_h */
@@ -43,6 +43,11 @@ int eventHandler(PlaydateAPI * _Nonnull api, PDSystemEvent event, uint32_t arg)
             playdate = api;
             setRefreshRate(DEFAULT_REFRESH_RATE);
             MELRandomInit();
+            MELTrigTableInit();
+#if DEBUG
+            const MELTrigTableError trigTableError = MELTrigTableMeasureError(4096);
+            api->system->logToConsole("Trig table error: sin %f, cos %f, atan2 %f", (double) trigTableError.sin, (double) trigTableError.cos, (double) trigTableError.atan2);
+#endif
             loadFonts();
             init();
             break;